@@ -0,0 +1,122 @@
+/**
+ * Compares the throughput of MLX90641_CalculateToBatch() against
+ * calculating the same frames one by one using MLX90641_CalculateTo().
+ *
+ * Runs on the host, using synthetic calibration data and frames.
+ * Build and run it using the `benchmark` environment in Platform IO.
+ */
+
+#include <MLX90641_API.h>
+#include <mlx90641_synthetic.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define FRAME_COUNT 20000
+#define FRAME_WORDS 242
+#define PIXEL_COUNT 192
+#define TA_SHIFT 5
+#define EMISSIVITY 0.95f
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main()
+{
+    static paramsMLX90641 params;
+    uint16_t ee[832];
+    float temps[PIXEL_COUNT];
+    uint16_t *frames = malloc(FRAME_COUNT * FRAME_WORDS * sizeof(uint16_t));
+    float *emissivity = malloc(FRAME_COUNT * sizeof(float));
+    float *scalarResult = malloc(FRAME_COUNT * PIXEL_COUNT * sizeof(float));
+    float *batchResult = malloc(FRAME_COUNT * PIXEL_COUNT * sizeof(float));
+    int threads = 1;
+    double start;
+    double scalarTime;
+    double batchTime;
+    float maxDiff = 0;
+
+    if (frames == NULL || emissivity == NULL || scalarResult == NULL || batchResult == NULL)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    mlx90641_synthetic_eeprom(ee);
+    if (MLX90641_ExtractParameters(ee, &params) != 0)
+    {
+        printf("Parameter extraction failed\n");
+        return 1;
+    }
+
+    // A room-temperature background with a hot spot moving around
+    for (int frame = 0; frame < FRAME_COUNT; frame++)
+    {
+        int hotPixel = (frame / 8) % PIXEL_COUNT;
+        for (int i = 0; i < PIXEL_COUNT; i++)
+        {
+            temps[i] = 20 + (i % 16) * 0.5f + (i == hotPixel ? 300 : 0);
+        }
+        mlx90641_synthetic_frame(&params, temps, 30 + (frame % 100) * 0.01f, 3.3f, frame % 2,
+                                 frames + frame * FRAME_WORDS);
+        emissivity[frame] = EMISSIVITY;
+    }
+
+    start = now_seconds();
+    for (int frame = 0; frame < FRAME_COUNT; frame++)
+    {
+        uint16_t *frameData = frames + frame * FRAME_WORDS;
+        frameContextMLX90641 context;
+        MLX90641_GetFrameContext(frameData, &params, &context);
+        MLX90641_CalculateTo(frameData, &params, &context, emissivity[frame], context.ta - TA_SHIFT,
+                             scalarResult + frame * PIXEL_COUNT);
+    }
+    scalarTime = now_seconds() - start;
+
+    batchMLX90641 batch = {
+        .frameCount = FRAME_COUNT,
+        .frameData = frames,
+        .emissivity = emissivity,
+        .tr = NULL,
+        .taShift = TA_SHIFT,
+        .ta = NULL,
+        .result = batchResult,
+    };
+    start = now_seconds();
+    MLX90641_CalculateToBatch(&params, &batch);
+    batchTime = now_seconds() - start;
+
+    for (int i = 0; i < FRAME_COUNT * PIXEL_COUNT; i++)
+    {
+        float diff = fabsf(batchResult[i] - scalarResult[i]);
+        if (diff > maxDiff)
+        {
+            maxDiff = diff;
+        }
+    }
+
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    printf("frames: %d, threads: %d\n", FRAME_COUNT, threads);
+    printf("scalar: %.0f frames/s\n", FRAME_COUNT / scalarTime);
+    printf("batch:  %.0f frames/s (%.1fx)\n", FRAME_COUNT / batchTime, scalarTime / batchTime);
+    printf("max difference: %.4f degC\n", maxDiff);
+
+    free(frames);
+    free(emissivity);
+    free(scalarResult);
+    free(batchResult);
+    return 0;
+}
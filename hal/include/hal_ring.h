@@ -0,0 +1,105 @@
+#ifndef HAL_RING_H
+#define HAL_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Single-producer/single-consumer ring of slot indices, used by HAL
+ * implementations to pass data from an interrupt handler or thread to the
+ * main loop without locking.
+ *
+ * The ring only manages indices, the caller owns the slots themselves (e.g.
+ * an array of frames of `size` entries).
+ * Indices are free-running, so `head - tail` is the number of filled slots.
+ */
+typedef struct HalRing
+{
+    uint32_t size;     // Number of slots, must be a power of 2
+    uint32_t head;     // Next slot to write, only modified by producer
+    uint32_t tail;     // Next slot to read, only modified by consumer
+    uint32_t overruns; // Entries dropped because ring was full, only modified by producer
+    uint32_t skipped;  // Entries skipped by hal_ring_read_slot(), only modified by consumer
+} HalRing;
+
+static inline void hal_ring_init(HalRing *ring, uint32_t size)
+{
+    ring->size = size;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->overruns = 0;
+    ring->skipped = 0;
+}
+
+/**
+ * Get slot to write next entry into (producer only).
+ * @returns slot index, or -1 when ring is full (entry has to be dropped,
+ *      which is counted as an overrun).
+ */
+static inline int hal_ring_write_slot(HalRing *ring)
+{
+    uint32_t head = ring->head;
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= ring->size)
+    {
+        __atomic_store_n(&ring->overruns, ring->overruns + 1, __ATOMIC_RELAXED);
+        return -1;
+    }
+    return head & (ring->size - 1);
+}
+
+/**
+ * Make slot returned by hal_ring_write_slot() available to the consumer.
+ */
+static inline void hal_ring_publish(HalRing *ring)
+{
+    __atomic_store_n(&ring->head, ring->head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Get number of filled slots (consumer only).
+ */
+static inline uint32_t hal_ring_count(HalRing *ring)
+{
+    return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - ring->tail;
+}
+
+/**
+ * Get slot to read next entry from (consumer only).
+ * @param latest When true, skip all but the newest entry ("latest wins").
+ * @returns slot index, or -1 when ring is empty.
+ */
+static inline int hal_ring_read_slot(HalRing *ring, bool latest)
+{
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if (head == tail)
+    {
+        return -1;
+    }
+    if (latest && head - tail > 1)
+    {
+        // Hand skipped slots back to the producer
+        __atomic_store_n(&ring->skipped, ring->skipped + (head - tail - 1), __ATOMIC_RELAXED);
+        tail = head - 1;
+        __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+    }
+    return tail & (ring->size - 1);
+}
+
+/**
+ * Hand slot returned by hal_ring_read_slot() back to the producer.
+ */
+static inline void hal_ring_release(HalRing *ring)
+{
+    __atomic_store_n(&ring->tail, ring->tail + 1, __ATOMIC_RELEASE);
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*HAL_RING_H*/
@@ -6,19 +6,64 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define THERMAL_COLS 16
 #define THERMAL_ROWS 12
 
 /**
- * Initialize IR hardware.
+ * Persistent storage for the sensor's calibration data, provided by the
+ * application. Allows skipping the (slow) readout and processing of the
+ * sensor's calibration data on subsequent boots.
+ */
+typedef struct ThermalCalibrationCache
+{
+    /**
+     * Load previously stored calibration data.
+     * @param key Identifies the sensor and data format, must match stored key
+     * @param data Buffer to fill
+     * @param len Size of data, must match stored size
+     * @returns true when data with given key and size was loaded, false otherwise
+     */
+    bool (*load)(uint32_t key, void *data, size_t len);
+
+    /**
+     * Store calibration data.
+     * @returns true when data was stored, false otherwise
+     */
+    bool (*store)(uint32_t key, const void *data, size_t len);
+} ThermalCalibrationCache;
+
+typedef enum ThermalInitStatus
+{
+    THERMAL_INIT_BUSY = 0,      // Initialization in progress
+    THERMAL_INIT_READY = 1,     // Sensor is ready for use
+    THERMAL_INIT_NOT_FOUND = 2, // No sensor responded
+    THERMAL_INIT_FAILED = 3,    // Sensor responded, but e.g. its calibration data is invalid
+} ThermalInitStatus;
+
+/**
+ * Start initializing IR hardware, which is performed in steps by
+ * `hal_thermal_init_step()` so the application stays responsive meanwhile.
+ * Can be called again to retry after a failure.
+ *
+ * @param cache Storage for calibration data, or NULL to always read it from the sensor
+ */
+void hal_thermal_init_start(const ThermalCalibrationCache *cache);
+
+/**
+ * Perform the next step of initialization (e.g. reading the calibration
+ * data), taking at most a few tens of milliseconds.
+ * The other hal_thermal functions can only be used once this returned
+ * THERMAL_INIT_READY.
  *
- * @return true when initialization successful, false otherwise
+ * @returns THERMAL_INIT_BUSY while more steps are needed, final status otherwise
  */
-bool hal_thermal_init();
+ThermalInitStatus hal_thermal_init_step(void);
 
 /**
- * Check whether new thermal data is available and if so, read it.
+ * Check whether a new frame has been captured and if so, calculate it.
  * @param pixels Array of pixels to fill with temperature in degrees Celsius
  * @param emissivity Emmisivity to use for calculation (0.0 .. 1.0)
  * @param auto_tr When true, derive ambient temperature from IR sensor's built-in sensor,
@@ -26,11 +71,295 @@ bool hal_thermal_init();
  * @param tr Reflected temperature to use for calculation. Must be provided by user when
  *      `auto_tr` is false, will be filled in with in-use value when non-NULL and `auto_tr`
  *      is true and data is available.
- * @returns true when new sub-page has been read (all pixels will have been updated), false
- *      if no data was available or an error occurred.
+ * @returns true when new sub-page has been calculated (all pixels will have been updated),
+ *      false if no data was available. In THERMAL_CAPTURE_STEP mode, only true for the
+ *      last sub-page of a triggered frame.
  */
 bool hal_thermal_tick(float pixels[THERMAL_COLS * THERMAL_ROWS], float emissivity, bool auto_tr, float *tr);
 
+/**
+ * First half of `hal_thermal_tick()`: check whether a new frame has been
+ * captured and if so, take it from the queue (a newer one replaces a frame
+ * that wasn't calculated yet).
+ * @returns true when a frame is waiting for `hal_thermal_calculate()`.
+ */
+bool hal_thermal_acquire(void);
+
+/**
+ * Second half of `hal_thermal_tick()`: calculate the frame taken by
+ * `hal_thermal_acquire()`. Parameters are the same as for `hal_thermal_tick()`.
+ * @returns true when all pixels have been updated, false when no frame was
+ *      acquired (or in THERMAL_CAPTURE_STEP mode, for the first sub-page).
+ */
+bool hal_thermal_calculate(float pixels[THERMAL_COLS * THERMAL_ROWS], float emissivity, bool auto_tr, float *tr);
+
+/**
+ * Check whether a newer frame has been captured, e.g. to skip showing the
+ * current one.
+ */
+bool hal_thermal_frame_pending(void);
+
+/**
+ * When the frame taken by `hal_thermal_acquire()` was captured, in
+ * hal_micros(), e.g. for measuring latency.
+ */
+typedef struct ThermalFrameTimes
+{
+    unsigned long data_ready_us; // Polling the sensor's status showed new data
+    unsigned long read_us;       // Reading it over I2C completed
+} ThermalFrameTimes;
+
+void hal_thermal_get_frame_times(ThermalFrameTimes *times);
+
+/**
+ * What `hal_thermal_tick()` puts in its `pixels` array.
+ */
+typedef enum ThermalMode
+{
+    /**
+     * Object temperature in degrees Celsius, at normal refresh rate.
+     */
+    THERMAL_MODE_TEMPERATURE = 0,
+    /**
+     * IR intensity (arbitrary unit, proportional to received radiation),
+     * without solving for temperature.
+     * Emissivity and reflected temperature are not used.
+     * Useful for e.g. presence or motion detection (at a high refresh rate).
+     */
+    THERMAL_MODE_RAW = 1,
+} ThermalMode;
+
+/**
+ * Switch between temperature and raw IR intensity output.
+ *
+ * @param mode New mode.
+ * @returns true when mode was switched, false otherwise.
+ */
+bool hal_thermal_set_mode(ThermalMode mode);
+
+/**
+ * Rate at which the sensor produces new sub-pages.
+ * Higher rates give more noise: it roughly doubles for every 4x increase.
+ */
+typedef enum ThermalRefreshRate
+{
+    THERMAL_REFRESH_0_5HZ = 0,
+    THERMAL_REFRESH_1HZ = 1,
+    THERMAL_REFRESH_2HZ = 2,
+    THERMAL_REFRESH_4HZ = 3,
+    THERMAL_REFRESH_8HZ = 4,
+    THERMAL_REFRESH_16HZ = 5,
+    THERMAL_REFRESH_32HZ = 6,
+    THERMAL_REFRESH_64HZ = 7,
+} ThermalRefreshRate;
+
+/**
+ * Change the sensor's refresh rate (8 Hz after initialization).
+ * It's capped to the highest rate at which sub-pages can be read at the
+ * current bus clock (e.g. 8 Hz at 100 kHz), and raised back to the requested
+ * rate when the clock allows it again.
+ *
+ * @param rate New refresh rate.
+ * @returns true when rate was changed, false otherwise.
+ */
+bool hal_thermal_set_refresh_rate(ThermalRefreshRate rate);
+
+/**
+ * Resolution of the sensor's ADC. Higher resolutions reduce quantization
+ * noise, but saturate at lower object temperatures.
+ */
+typedef enum ThermalResolution
+{
+    THERMAL_RESOLUTION_16BIT = 0,
+    THERMAL_RESOLUTION_17BIT = 1,
+    THERMAL_RESOLUTION_18BIT = 2,
+    THERMAL_RESOLUTION_19BIT = 3,
+} ThermalResolution;
+
+/**
+ * Change the sensor's ADC resolution (the sensor's default, normally 18 bit,
+ * after initialization). Sub-pages measured while changing are
+ * discarded, as they don't match the new setting.
+ *
+ * @param resolution New resolution.
+ * @returns true when resolution was changed, false otherwise.
+ */
+bool hal_thermal_set_resolution(ThermalResolution resolution);
+
+/**
+ * How `hal_thermal_tick()` combines the sensor's two sub-pages, which are
+ * measured alternately and each cover all pixels.
+ * Only used in THERMAL_MODE_TEMPERATURE.
+ */
+typedef enum ThermalFusion
+{
+    /**
+     * Return the result of the newest sub-page only.
+     */
+    THERMAL_FUSION_OFF = 0,
+    /**
+     * Average the newest results of both sub-pages, halving the noise power
+     * but also smearing movement over two sub-pages.
+     */
+    THERMAL_FUSION_AVERAGE = 1,
+    /**
+     * Average like THERMAL_FUSION_AVERAGE, except for pixels that changed
+     * significantly between sub-pages, for which the newest result is used.
+     */
+    THERMAL_FUSION_MOTION = 2,
+} ThermalFusion;
+
+/**
+ * Set how sub-pages are combined (THERMAL_FUSION_OFF after initialization).
+ * Still returns a frame for every sub-page. Only consecutive sub-pages are
+ * combined: after a frame was lost or skipped, the newest one is returned as is.
+ */
+void hal_thermal_set_fusion(ThermalFusion fusion);
+
+/**
+ * Which frames `hal_thermal_tick()` returns when frames were captured faster
+ * than they were consumed (e.g. while the UI was busy).
+ */
+typedef enum ThermalQueuePolicy
+{
+    /**
+     * Return every captured frame, in order.
+     */
+    THERMAL_QUEUE_ALL = 0,
+    /**
+     * Only return the newest captured frame, skipping older ones.
+     */
+    THERMAL_QUEUE_LATEST = 1,
+} ThermalQueuePolicy;
+
+/**
+ * Set which queued frames `hal_thermal_tick()` returns.
+ * Frames are captured in the background (from a timer interrupt or thread),
+ * and queued until `hal_thermal_tick()` is called.
+ */
+void hal_thermal_set_queue_policy(ThermalQueuePolicy policy);
+
+/**
+ * When the sensor measures.
+ */
+typedef enum ThermalCaptureMode
+{
+    /**
+     * Measure continuously at the refresh rate.
+     */
+    THERMAL_CAPTURE_CONTINUOUS = 0,
+    /**
+     * Sensor stays idle (saving power) until `hal_thermal_trigger()` is
+     * called, then measures a single frame.
+     */
+    THERMAL_CAPTURE_STEP = 1,
+} ThermalCaptureMode;
+
+/**
+ * Switch between continuous and on-demand measurement
+ * (THERMAL_CAPTURE_CONTINUOUS after initialization).
+ *
+ * @param mode New capture mode.
+ * @returns true when mode was switched, false otherwise.
+ */
+bool hal_thermal_set_capture_mode(ThermalCaptureMode mode);
+
+/**
+ * Measure a single frame in THERMAL_CAPTURE_STEP mode.
+ * Both sub-pages are measured one after the other, starting after this call,
+ * and `hal_thermal_tick()` only returns true once the second one has been
+ * calculated (combined with the first according to the fusion setting).
+ * So the frame is available after two sub-page times of the refresh rate
+ * (e.g. 250 ms at 8 Hz), plus reading it.
+ *
+ * @returns true when measurement was started, false when not in step mode or
+ *      the previous frame is still being measured.
+ */
+bool hal_thermal_trigger(void);
+
+typedef struct ThermalCaptureStats
+{
+    uint32_t captured; // Frames read from the sensor
+    uint32_t overruns; // Frames dropped because the queue was full
+    uint32_t skipped;  // Frames skipped due to THERMAL_QUEUE_LATEST
+    uint32_t errors;   // Failed reads
+} ThermalCaptureStats;
+
+/**
+ * Get counters of background frame capture, since initialization.
+ */
+void hal_thermal_get_capture_stats(ThermalCaptureStats *stats);
+
+typedef struct ThermalBusStats
+{
+    uint32_t transactions;   // I2C transactions
+    uint32_t bytes;          // Bytes transferred, including addresses
+    uint32_t nacks;          // Transactions that weren't acknowledged or completed
+    uint32_t invalid_frames; // Frames that failed validation, e.g. corrupted on the bus
+    uint32_t retries;        // Failed transfers of a frame that were retried
+    uint32_t lost_frames;    // Frames given up on after errors
+    uint16_t clock_khz;      // Current bus clock
+} ThermalBusStats;
+
+/**
+ * Get counters of the sensor's bus, since startup.
+ */
+void hal_thermal_get_bus_stats(ThermalBusStats *stats);
+
+/**
+ * Value for `hal_thermal_set_bus_clock()` to tune the clock automatically.
+ */
+#define THERMAL_BUS_CLOCK_AUTO 0
+
+/**
+ * Set the sensor's bus clock (1000 kHz by default). Lower clocks are more
+ * reliable (e.g. with long cables), but reading a frame takes longer, which
+ * may limit the refresh rate (see hal_thermal_set_refresh_rate()).
+ * The automatic mode lowers the clock step by step on bursts of errors,
+ * and raises it again once the bus has been without errors for a while.
+ *
+ * @param khz Clock in kHz (100 .. 1000), or THERMAL_BUS_CLOCK_AUTO.
+ * @returns true when clock was changed, false otherwise.
+ */
+bool hal_thermal_set_bus_clock(uint16_t khz);
+
+/**
+ * Destination of raw sensor recordings, provided by the application.
+ */
+typedef struct ThermalRecorder
+{
+    /**
+     * Append data to the recording.
+     * @returns true when data was written, false otherwise (which stops the recording)
+     */
+    bool (*write)(const void *data, size_t len);
+} ThermalRecorder;
+
+/**
+ * Start recording the sensor's calibration data and every frame read by
+ * `hal_thermal_tick()` (including frames skipped due to THERMAL_QUEUE_LATEST),
+ * without any processing. The format is sensor-specific, see
+ * hal/mlx90641/mlx90641_recording.h.
+ *
+ * @param recorder Destination of recording, must stay valid until recording is stopped
+ * @returns true when recording was started, false otherwise.
+ */
+bool hal_thermal_start_recording(const ThermalRecorder *recorder);
+
+/**
+ * Stop recording. No-op when not recording.
+ */
+void hal_thermal_stop_recording(void);
+
+/**
+ * Recalculate temperatures of the last frame read by `hal_thermal_tick()`,
+ * e.g. to immediately show the effect of a changed emissivity instead of
+ * waiting for the next frame.
+ * Parameters are the same as for `hal_thermal_tick()`.
+ * @returns true when all pixels have been updated, false if no frame is available.
+ */
+bool hal_thermal_recompute(float pixels[THERMAL_COLS * THERMAL_ROWS], float emissivity, bool auto_tr, float *tr);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
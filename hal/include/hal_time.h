@@ -9,6 +9,7 @@ extern "C" {
 
 void hal_sleep(unsigned long milliseconds);
 unsigned long hal_millis();
+unsigned long hal_micros();
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,1059 @@
+/**
+ * Thermal HAL for the MLX90641, shared by the device and the simulator (which
+ * emulates the sensor), see mlx90641_platform.h for the platform-specific parts.
+ */
+
+#include <MLX90641_API.h>
+#include <MLX90641_I2C_Driver.h>
+
+#include "hal_print.h"
+#include "hal_ring.h"
+#include "hal_thermal.h"
+#include "hal_time.h"
+#include "mlx90641_platform.h"
+#include "mlx90641_recording.h"
+
+#include <math.h>
+#include <string.h>
+
+const uint8_t MLX90641_address = 0x33; // Default 7-bit unshifted address of the MLX90641
+#define TA_SHIFT 5                     // Default shift for MLX90641 in open air
+
+// Radiometry kernel to use: 0 for floating point (MLX90641_CalculateTo),
+// 1 for fixed point (MLX90641_CalculateToFixed).
+#ifndef THERMAL_FIXED_POINT
+#define THERMAL_FIXED_POINT 0
+#endif
+
+// Capture frames in the background (1), i.e. from a timer interrupt on the
+// device, so no sub-page is missed while the main loop is busy (e.g. writing
+// to flash), or from hal_thermal_tick() (0).
+#ifndef THERMAL_CAPTURE_TIMER
+#define THERMAL_CAPTURE_TIMER 1
+#endif
+
+// Interval (in microseconds) of background capture at a 1 MHz bus clock,
+// scaled inversely with the clock. Each call performs one I2C transfer (~0.6 ms
+// for a block of pixels at 1 MHz) of the frame being read, so the main loop
+// keeps running in between.
+#ifndef THERMAL_CAPTURE_PERIOD_US
+#define THERMAL_CAPTURE_PERIOD_US 1000
+#endif
+
+// Number of capture periods to allow for reading a sub-page: polling the
+// status, clearing it, 6 blocks of pixels, aux data and control register, and
+// one retry. Limits the refresh rate, see hal_thermal_set_refresh_rate().
+#define THERMAL_CAPTURE_CALLS_PER_SUBPAGE 12
+
+// Maximum time (in microseconds) to spend on reading a frame per call to
+// hal_thermal_tick(), when not using the capture timer. Reading continues
+// in the next call when the budget is used up, to keep the UI responsive.
+#ifndef THERMAL_TICK_BUDGET_US
+#define THERMAL_TICK_BUDGET_US 2000
+#endif
+
+// Pixels whose result differs by more than this many degrees between
+// sub-pages are not averaged in THERMAL_FUSION_MOTION, with a gradual
+// transition up to twice this value.
+#ifndef THERMAL_FUSION_THRESHOLD
+#define THERMAL_FUSION_THRESHOLD 1.0f
+#endif
+
+// Default clock (in kHz) of the sensor's bus, see hal_thermal_set_bus_clock().
+#ifndef THERMAL_I2C_KHZ
+#define THERMAL_I2C_KHZ 1000
+#endif
+
+// Automatic bus clock tuning: the clock is lowered when at least
+// THERMAL_AUTOTUNE_ERRORS errors occur within THERMAL_AUTOTUNE_WINDOW_MS, and
+// raised again after THERMAL_AUTOTUNE_CLEAN_MS without errors. When raising
+// fails right away, the next attempt waits twice as long (up to 8x).
+#ifndef THERMAL_AUTOTUNE_WINDOW_MS
+#define THERMAL_AUTOTUNE_WINDOW_MS 1000
+#endif
+#ifndef THERMAL_AUTOTUNE_ERRORS
+#define THERMAL_AUTOTUNE_ERRORS 3
+#endif
+#ifndef THERMAL_AUTOTUNE_CLEAN_MS
+#define THERMAL_AUTOTUNE_CLEAN_MS 30000
+#endif
+
+// Number of captured frames that can be queued until hal_thermal_tick()
+// is called, must be a power of 2.
+#ifndef THERMAL_QUEUE_SIZE
+#define THERMAL_QUEUE_SIZE 4
+#endif
+
+// Print radiometry statistics (e.g. scene cache hit rate) every
+// this many frames. Set to 0 to disable.
+#ifndef THERMAL_STATS_INTERVAL
+#define THERMAL_STATS_INTERVAL 0
+#endif
+
+uint16_t MLX90641Frame[242];
+paramsMLX90641 MLX90641;
+
+// Context of MLX90641Frame, valid when haveFrame is true
+static frameContextMLX90641 MLX90641Context;
+static bool haveFrame = false;
+
+// True when hal_thermal_init_step() completed, i.e. the sensor is configured
+// and calibration data is available
+static bool ready = false;
+
+static ThermalMode mode = THERMAL_MODE_TEMPERATURE;
+static ThermalQueuePolicy queuePolicy = THERMAL_QUEUE_ALL;
+static ThermalFusion fusion = THERMAL_FUSION_OFF;
+
+// Refresh rate requested by hal_thermal_set_refresh_rate(), and the one the
+// sensor is set to (lower when the bus clock can't keep up, -1 when unknown)
+static ThermalRefreshRate refreshRate = THERMAL_REFRESH_8HZ;
+static int appliedRefreshRate = -1;
+
+// Newest result of each sub-page and its frame's sequence number, for fusion
+static float subPageResult[2][THERMAL_COLS * THERMAL_ROWS];
+static uint32_t resultSequence[2];
+static bool haveResult[] = {false, false};
+
+// Owned by capture(), i.e. the background capture when it's running
+static frameReaderMLX90641 frameReader;
+static triggerMLX90641 stepTrigger;
+static uint16_t captureFrame[242];
+static volatile uint32_t capturedCount = 0;
+static volatile uint32_t errorCount = 0;
+static volatile uint32_t invalidCount = 0;
+static volatile uint32_t retryCount = 0;
+static volatile uint32_t lostCount = 0;
+
+// Frame in MLX90641Frame that hal_thermal_calculate() hasn't calculated yet,
+// its sequence number and whether it completes a triggered frame in step mode
+static bool acquired = false;
+static uint32_t acquiredSequence;
+static bool acquiredComplete = false;
+static ThermalFrameTimes acquiredTimes;
+
+// Number of frames to drop, e.g. because they were measured using previous
+// settings. Only modified while capture is paused.
+static int discardCount = 0;
+
+// Step mode: sub-pages (bit mask) still needed for the triggered frame, and
+// whether capture() has to start measuring the next one. Only modified by
+// capture(), or while capture is paused.
+static ThermalCaptureMode captureMode = THERMAL_CAPTURE_CONTINUOUS;
+static volatile uint8_t stepPages = 0;
+static volatile bool stepStart = false;
+// Whether the new data flag was cleared for the measurement being triggered
+static bool stepCleared = false;
+// hal_millis() after which a measurement started before entering step mode
+// has certainly completed
+static unsigned long stepIdleTime;
+
+// Captured frames, their capture time (hal_millis()), sequence number
+// (frameSequence, so lost and dropped frames leave a gap), latency
+// timestamps and whether they complete a triggered frame, passed from
+// capture() to hal_thermal_acquire()
+static uint16_t queuedFrames[THERMAL_QUEUE_SIZE][242];
+static unsigned long queuedTimes[THERMAL_QUEUE_SIZE];
+static uint32_t queuedSequence[THERMAL_QUEUE_SIZE];
+static ThermalFrameTimes queuedFrameTimes[THERMAL_QUEUE_SIZE];
+static bool queuedComplete[THERMAL_QUEUE_SIZE];
+
+// hal_micros() at which capture() saw the frame being read now, and the
+// number of frames it has seen
+static unsigned long dataReadyTime;
+static uint32_t frameSequence = 0;
+static HalRing queue;
+
+// Bus clocks (in kHz) used by the automatic tuning, fastest first
+static const uint16_t busClocks[] = {1000, 800, 600, 400, 200, 100};
+#define BUS_CLOCK_COUNT (sizeof(busClocks) / sizeof(busClocks[0]))
+
+static uint16_t busClock = THERMAL_I2C_KHZ;
+static bool busAutotune = false;
+static unsigned int busClockIndex;       // Into busClocks, while tuning
+static unsigned long tuneWindowStart;    // hal_millis()
+static uint32_t tuneErrors;              // Bus errors at start of window
+static unsigned long tuneCleanSince;     // hal_millis() of last error
+static unsigned long tuneLastRaise;      // hal_millis() of last raise
+static unsigned long tuneRaiseDelay = THERMAL_AUTOTUNE_CLEAN_MS;
+
+// Active recording, if any
+static const ThermalRecorder *recorder = NULL;
+static unsigned long recordingStart;
+
+/**
+ * Perform the next I2C transfer of reading a frame, and queue the frame when
+ * it's complete.
+ * @returns true when more transfers are needed to complete the frame
+ */
+static bool capture(void)
+{
+    if (captureMode == THERMAL_CAPTURE_STEP)
+    {
+        if (stepPages == 0 || (long)(hal_millis() - stepIdleTime) < 0)
+        {
+            return false;
+        }
+
+        if (stepStart)
+        {
+            // One transfer per call, like reading a frame
+            if (!stepCleared)
+            {
+                // Clear data of an earlier measurement, so only the new one is read
+                if (MLX90641_I2CWrite(MLX90641_address, 0x8000, 0x0010) == -1)
+                {
+                    errorCount++;
+                    return false;
+                }
+                stepCleared = true;
+                return true;
+            }
+
+            int result = MLX90641_StepTrigger(MLX90641_address, &stepTrigger);
+            if (result == MLX90641_TRIGGER_IN_PROGRESS)
+            {
+                return true;
+            }
+            // Clear again when starting over after an error (the trigger
+            // resets itself)
+            stepCleared = false;
+            if (result != 0)
+            {
+                errorCount++;
+                return false;
+            }
+            stepStart = false;
+            return false;
+        }
+    }
+
+    bool reading = frameReader.state != 0;
+    unsigned long pollTime = hal_micros();
+    int subPage = MLX90641_StepFrameData(MLX90641_address, &frameReader, captureFrame);
+    if (!reading && subPage != MLX90641_FRAME_NOT_READY)
+    {
+        // Status showed new data
+        dataReadyTime = pollTime;
+        frameSequence++;
+    }
+    if (subPage == MLX90641_FRAME_IN_PROGRESS)
+    {
+        return true;
+    }
+
+    if (subPage == MLX90641_FRAME_NOT_READY)
+    {
+        return false;
+    }
+
+    if (subPage < 0)
+    {
+        errorCount++;
+        if (subPage == -8)
+        {
+            invalidCount++;
+        }
+        if (frameReader.state != 0)
+        {
+            // Failed transfer is retried on the next call
+            retryCount++;
+            return true;
+        }
+        if (reading)
+        {
+            // Reader gave up on the frame, its new data flag was already cleared
+            lostCount++;
+        }
+        // Measure again in step mode, the sub-page may be lost
+        stepStart = stepPages != 0;
+        return false;
+    }
+
+    if (discardCount > 0)
+    {
+        discardCount--;
+        stepStart = stepPages != 0;
+        return false;
+    }
+
+    // Sub-pages alternate, but e.g. after an error the same one may be
+    // measured twice, so keep going until both have been seen
+    bool complete = false;
+    if (stepPages != 0)
+    {
+        stepPages &= ~(1 << subPage);
+        stepStart = stepPages != 0;
+        complete = stepPages == 0;
+    }
+
+    capturedCount++;
+    int slot = hal_ring_write_slot(&queue);
+    if (slot >= 0)
+    {
+        memcpy(queuedFrames[slot], captureFrame, sizeof(captureFrame));
+        queuedTimes[slot] = hal_millis();
+        queuedSequence[slot] = frameSequence;
+        queuedFrameTimes[slot].data_ready_us = dataReadyTime;
+        queuedFrameTimes[slot].read_us = hal_micros();
+        queuedComplete[slot] = complete;
+        hal_ring_publish(&queue);
+    }
+    return false;
+}
+
+#if THERMAL_CAPTURE_TIMER
+static void capture_cb(void)
+{
+    capture();
+}
+#endif
+
+/**
+ * Interval of background capture at the current bus clock, see
+ * THERMAL_CAPTURE_PERIOD_US.
+ */
+static unsigned long capture_period_us(void)
+{
+    return THERMAL_CAPTURE_PERIOD_US * 1000UL / busClock;
+}
+
+/**
+ * Highest refresh rate at which a sub-page is read before the next one is
+ * measured, at the current bus clock.
+ */
+static ThermalRefreshRate max_refresh_rate(void)
+{
+    unsigned long readTime = THERMAL_CAPTURE_CALLS_PER_SUBPAGE * capture_period_us();
+    int rate = THERMAL_REFRESH_64HZ;
+    // Each step doubles the rate, from one sub-page per 2 s at 0.5 Hz
+    while (rate > THERMAL_REFRESH_0_5HZ && (2000000UL >> rate) < readTime)
+    {
+        rate--;
+    }
+    return (ThermalRefreshRate)rate;
+}
+
+/**
+ * Set the sensor to the requested refresh rate, capped to max_refresh_rate(),
+ * when that differs from the current one.
+ */
+static bool apply_refresh_rate(void)
+{
+    ThermalRefreshRate maxRate = max_refresh_rate();
+    ThermalRefreshRate rate = refreshRate < maxRate ? refreshRate : maxRate;
+    if ((int)rate == appliedRefreshRate)
+    {
+        return true;
+    }
+
+    mlx90641_platform_capture_pause();
+    int status = MLX90641_SetRefreshRate(MLX90641_address, rate);
+    mlx90641_platform_capture_resume();
+    if (status != 0)
+    {
+        return false;
+    }
+    appliedRefreshRate = rate;
+    if (rate < refreshRate)
+    {
+        hal_printf("I2C: %u kHz is too slow for refresh rate %d, using %d\n", busClock, refreshRate, rate);
+    }
+    return true;
+}
+
+static void calculate(float *pixels, float emissivity, bool auto_tr, float *tr)
+{
+    // Determine reflected temperature to use: use built-in ambient
+    // temperature sensor or user-defined temperature.
+    float trToUse;
+    if (auto_tr || tr == NULL)
+    {
+        trToUse = MLX90641Context.ta - TA_SHIFT;
+        if (tr != NULL)
+        {
+            *tr = trToUse;
+        }
+    }
+    else
+    {
+        trToUse = *tr;
+    }
+
+    if (mode == THERMAL_MODE_RAW)
+    {
+        MLX90641_GetImage(MLX90641Frame, &MLX90641, &MLX90641Context, pixels);
+    }
+    else
+    {
+#if THERMAL_FIXED_POINT
+        MLX90641_CalculateToFixed(MLX90641Frame, &MLX90641, &MLX90641Context, emissivity, trToUse, pixels);
+#else
+        MLX90641_CalculateTo(MLX90641Frame, &MLX90641, &MLX90641Context, emissivity, trToUse, pixels);
+#endif
+    }
+
+    // Replace pixels marked as broken in the sensor's EEPROM
+    MLX90641_ApplyBadPixelTable(&MLX90641.badPixelTable, pixels);
+}
+
+/**
+ * Combine newest result of current sub-page (in pixels) with the other sub-page,
+ * if that's from the frame captured just before, i.e. no frame was dropped in
+ * between (e.g. by THERMAL_QUEUE_LATEST, an overrun or a lost frame).
+ */
+static void fuse(float *pixels, int subPage, uint32_t sequence)
+{
+    memcpy(subPageResult[subPage], pixels, sizeof(subPageResult[subPage]));
+    resultSequence[subPage] = sequence;
+    haveResult[subPage] = true;
+
+    if (mode != THERMAL_MODE_TEMPERATURE || fusion == THERMAL_FUSION_OFF || !haveResult[!subPage] ||
+        resultSequence[!subPage] != sequence - 1)
+    {
+        return;
+    }
+
+    const float *other = subPageResult[!subPage];
+    for (int i = 0; i < THERMAL_COLS * THERMAL_ROWS; i++)
+    {
+        // Weight of the other sub-page, from 0.5 (average) down to 0 (newest only)
+        float weight = 0.5f;
+        if (fusion == THERMAL_FUSION_MOTION)
+        {
+            float change = fabsf(pixels[i] - other[i]);
+            if (change > THERMAL_FUSION_THRESHOLD)
+            {
+                weight = change >= 2 * THERMAL_FUSION_THRESHOLD
+                             ? 0
+                             : 0.5f * (2 - change / THERMAL_FUSION_THRESHOLD);
+            }
+        }
+        pixels[i] += weight * (other[i] - pixels[i]);
+    }
+}
+
+/**
+ * Version of the cached calibration data, i.e. of paramsMLX90641 and how
+ * MLX90641_ExtractParameters() fills it. Bump it on any change to either, so
+ * data cached by an older firmware is extracted again.
+ */
+#define CALIBRATION_FORMAT_VERSION 1
+
+/**
+ * Compute key identifying the sensor's calibration data, from the EEPROM's
+ * configuration and device ID words, and the format of the extracted
+ * parameters (CALIBRATION_FORMAT_VERSION and size).
+ */
+static bool read_calibration_key(uint32_t *key)
+{
+    uint16_t header[16];
+    int status = MLX90641_I2CRead(MLX90641_address, 0x2400, 16, header);
+    if (status != 0)
+    {
+        return false;
+    }
+
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    for (int i = 0; i < 16; i++)
+    {
+        hash = (hash ^ header[i]) * 16777619UL;
+    }
+    hash = (hash ^ CALIBRATION_FORMAT_VERSION) * 16777619UL;
+    hash = (hash ^ sizeof(paramsMLX90641)) * 16777619UL;
+
+    *key = hash;
+    return true;
+}
+
+/**
+ * When tuning the bus clock, use a lower one for the next initialization
+ * attempt (it's applied on reset).
+ */
+static void init_failed_on_bus(void)
+{
+    if (busAutotune && busClockIndex + 1 < BUS_CLOCK_COUNT)
+    {
+        busClockIndex++;
+        busClock = busClocks[busClockIndex];
+        hal_printf("I2C: lowered clock to %u kHz\n", busClock);
+    }
+}
+
+/**
+ * Steps of hal_thermal_init_step(). Each step performs at most one blocking
+ * operation, the longest being the EEPROM dump (~1664 bytes over I2C).
+ */
+typedef enum InitState
+{
+    INIT_IDLE,
+    INIT_RESET,
+    INIT_WAIT,
+    INIT_PROBE,
+    INIT_READ_EEPROM,
+    INIT_EXTRACT,
+    INIT_STORE,
+    INIT_CONFIGURE,
+} InitState;
+
+static InitState initState = INIT_IDLE;
+static const ThermalCalibrationCache *initCache;
+static unsigned long initResetTime;
+static uint32_t calibrationKey;
+static uint16_t eeMLX90641[832];
+
+void hal_thermal_init_start(const ThermalCalibrationCache *cache)
+{
+    initCache = cache;
+    initState = INIT_RESET;
+    ready = false;
+}
+
+ThermalInitStatus hal_thermal_init_step(void)
+{
+    int status;
+
+    switch (initState)
+    {
+    case INIT_IDLE:
+        return ready ? THERMAL_INIT_READY : THERMAL_INIT_FAILED;
+
+    case INIT_RESET:
+        mlx90641_platform_capture_stop();
+        mlx90641_platform_init();
+        MLX90641_I2CFreqSet(busClock);
+        MLX90641_I2CGeneralReset();
+        initResetTime = hal_millis();
+        initState = INIT_WAIT;
+        break;
+
+    case INIT_WAIT:
+        if (hal_millis() - initResetTime >= 80) // according to MLX datasheet
+        {
+            initState = INIT_PROBE;
+        }
+        break;
+
+    case INIT_PROBE:
+        initState = INIT_IDLE;
+        if (!mlx90641_platform_probe(MLX90641_address))
+        {
+            hal_printf("Cannot find MLX90641 at address 0x%X\n", MLX90641_address);
+            return THERMAL_INIT_NOT_FOUND;
+        }
+
+        if (!read_calibration_key(&calibrationKey))
+        {
+            hal_printf("Failed to read EEPROM header\n");
+            init_failed_on_bus();
+            return THERMAL_INIT_FAILED;
+        }
+
+        if (initCache != NULL && initCache->load(calibrationKey, &MLX90641, sizeof(MLX90641)))
+        {
+            hal_printf("Using cached calibration data\n");
+            initState = INIT_CONFIGURE;
+        }
+        else
+        {
+            initState = INIT_READ_EEPROM;
+        }
+        break;
+
+    case INIT_READ_EEPROM:
+        status = MLX90641_DumpEE(MLX90641_address, eeMLX90641);
+        if (status != 0)
+        {
+            eepromStatsMLX90641 stats;
+            MLX90641_GetEEPROMStats(&stats);
+            hal_printf("Failed to load EEPROM parameters (%d): %u corrected, %u uncorrectable words\n", status,
+                       stats.corrected, stats.uncorrectable);
+            init_failed_on_bus();
+            initState = INIT_IDLE;
+            return THERMAL_INIT_FAILED;
+        }
+        initState = INIT_EXTRACT;
+        break;
+
+    case INIT_EXTRACT:
+        status = MLX90641_ExtractParameters(eeMLX90641, &MLX90641);
+        if (status != 0)
+        {
+            hal_printf("Parameter extraction failed\n");
+            initState = INIT_IDLE;
+            return THERMAL_INIT_FAILED;
+        }
+        initState = INIT_STORE;
+        break;
+
+    case INIT_STORE:
+        if (initCache != NULL && !initCache->store(calibrationKey, &MLX90641, sizeof(MLX90641)))
+        {
+            hal_printf("Failed to cache calibration data\n");
+        }
+        initState = INIT_CONFIGURE;
+        break;
+
+    case INIT_CONFIGURE:
+        // ThermalRefreshRate matches the sensor's refresh rate setting
+        refreshRate = THERMAL_REFRESH_8HZ;
+        appliedRefreshRate = -1;
+        apply_refresh_rate();
+        mode = THERMAL_MODE_TEMPERATURE;
+        fusion = THERMAL_FUSION_OFF;
+        haveFrame = false;
+        acquired = false;
+        haveResult[0] = false;
+        haveResult[1] = false;
+        memset(&frameReader, 0, sizeof(frameReader));
+        capturedCount = 0;
+        errorCount = 0;
+        discardCount = 0;
+        captureMode = THERMAL_CAPTURE_CONTINUOUS;
+        stepPages = 0;
+        stepStart = false;
+        stepCleared = false;
+        memset(&stepTrigger, 0, sizeof(stepTrigger));
+        hal_ring_init(&queue, THERMAL_QUEUE_SIZE);
+#if THERMAL_CAPTURE_TIMER
+        mlx90641_platform_capture_start(capture_cb, capture_period_us());
+#endif
+        initState = INIT_IDLE;
+        ready = true;
+        return THERMAL_INIT_READY;
+    }
+
+    return THERMAL_INIT_BUSY;
+}
+
+bool hal_thermal_start_recording(const ThermalRecorder *newRecorder)
+{
+    static Mlx90641RecordingHeader header;
+
+    hal_thermal_stop_recording();
+    if (!ready)
+    {
+        return false;
+    }
+
+    header.magic = MLX90641_RECORDING_MAGIC;
+    header.version = MLX90641_RECORDING_VERSION;
+    header.eeprom_words = MLX90641_RECORDING_EEPROM_WORDS;
+    header.frame_words = MLX90641_RECORDING_FRAME_WORDS;
+    header.reserved = 0;
+
+    // Record EEPROM as-is, MLX90641_DumpEE() strips the Hamming code
+    mlx90641_platform_capture_pause();
+    int status = MLX90641_I2CRead(MLX90641_address, 0x2400, MLX90641_RECORDING_EEPROM_WORDS, header.eeprom);
+    mlx90641_platform_capture_resume();
+    if (status != 0 || !newRecorder->write(&header, sizeof(header)))
+    {
+        return false;
+    }
+
+    recorder = newRecorder;
+    recordingStart = hal_millis();
+    return true;
+}
+
+void hal_thermal_stop_recording(void)
+{
+    recorder = NULL;
+}
+
+static void record_frame(unsigned long time, const uint16_t *frameData)
+{
+    if (recorder == NULL || (long)(time - recordingStart) < 0)
+    {
+        return;
+    }
+
+    Mlx90641RecordingFrame frame;
+    frame.time_ms = time - recordingStart;
+    memcpy(frame.data, frameData, sizeof(frame.data));
+    if (!recorder->write(&frame, sizeof(frame)))
+    {
+        hal_printf("Recording failed, stopped\n");
+        recorder = NULL;
+    }
+}
+
+bool hal_thermal_set_mode(ThermalMode newMode)
+{
+    mode = newMode;
+    haveResult[0] = false;
+    haveResult[1] = false;
+    return true;
+}
+
+void hal_thermal_set_fusion(ThermalFusion newFusion)
+{
+    fusion = newFusion;
+}
+
+bool hal_thermal_set_refresh_rate(ThermalRefreshRate rate)
+{
+    if (!ready)
+    {
+        return false;
+    }
+
+    // At 1 MHz, reading a sub-page takes ~12 ms, so even 64 Hz is possible
+    refreshRate = rate;
+    return apply_refresh_rate();
+}
+
+bool hal_thermal_set_resolution(ThermalResolution resolution)
+{
+    // The control register is read along with each frame, and used to correct
+    // Vdd for the resolution. So frames that were measured at the previous
+    // resolution but read after the change would be miscalculated: the one
+    // being measured, and the one being read (if any). In step mode, the
+    // sensor is idle unless a triggered frame is being measured.
+    if (!ready)
+    {
+        return false;
+    }
+    mlx90641_platform_capture_pause();
+    int status = MLX90641_SetResolution(MLX90641_address, resolution);
+    if (status == 0)
+    {
+        discardCount = captureMode == THERMAL_CAPTURE_STEP ? stepPages != 0 : 2;
+    }
+    mlx90641_platform_capture_resume();
+    return status == 0;
+}
+
+bool hal_thermal_set_capture_mode(ThermalCaptureMode newMode)
+{
+    if (!ready)
+    {
+        return false;
+    }
+
+    uint16_t control;
+    mlx90641_platform_capture_pause();
+    int status = MLX90641_I2CRead(MLX90641_address, 0x800D, 1, &control);
+    if (status == 0)
+    {
+        // Bit 1 of control register 1 selects step mode
+        control = newMode == THERMAL_CAPTURE_STEP ? control | 0x0002 : control & ~0x0002;
+        status = MLX90641_I2CWrite(MLX90641_address, 0x800D, control);
+    }
+    if (status == 0)
+    {
+        // A measurement that's in progress still completes, with some
+        // margin for the tolerance of the sensor's clock
+        unsigned long subPageTime = 2000UL >> ((control >> 7) & 0x07);
+        stepIdleTime = hal_millis() + subPageTime + subPageTime / 4;
+        captureMode = newMode;
+        stepPages = 0;
+        stepStart = false;
+        stepCleared = false;
+        memset(&stepTrigger, 0, sizeof(stepTrigger));
+        // Frame being read (if any) was measured in the previous mode
+        memset(&frameReader, 0, sizeof(frameReader));
+    }
+    mlx90641_platform_capture_resume();
+    return status == 0;
+}
+
+bool hal_thermal_trigger(void)
+{
+    if (!ready || captureMode != THERMAL_CAPTURE_STEP || stepPages != 0)
+    {
+        return false;
+    }
+
+    mlx90641_platform_capture_pause();
+    stepPages = 0x03;
+    stepStart = true;
+    mlx90641_platform_capture_resume();
+    return true;
+}
+
+static uint32_t bus_errors(void)
+{
+    Mlx90641BusStats busStats;
+    mlx90641_platform_get_bus_stats(&busStats);
+    return busStats.nacks + invalidCount;
+}
+
+static void apply_bus_clock(uint16_t khz)
+{
+    busClock = khz;
+    if (!ready && initState == INIT_IDLE)
+    {
+        // Bus isn't set up yet, it's clocked when initializing
+        return;
+    }
+    mlx90641_platform_capture_pause();
+    MLX90641_I2CFreqSet(khz);
+    mlx90641_platform_capture_resume();
+    if (!ready)
+    {
+        // Applied at the end of initialization
+        return;
+    }
+
+    // Keep each capture call's transfer well within its period, and the
+    // refresh rate within what the bus can read
+#if THERMAL_CAPTURE_TIMER
+    mlx90641_platform_capture_start(capture_cb, capture_period_us());
+#endif
+    if (!apply_refresh_rate())
+    {
+        hal_printf("ERROR: Setting refresh rate failed.\n");
+    }
+}
+
+bool hal_thermal_set_bus_clock(uint16_t khz)
+{
+    if (khz == THERMAL_BUS_CLOCK_AUTO)
+    {
+        if (!busAutotune)
+        {
+            // Start tuning from the nearest step at or below the current clock
+            busClockIndex = 0;
+            while (busClockIndex + 1 < BUS_CLOCK_COUNT && busClocks[busClockIndex] > busClock)
+            {
+                busClockIndex++;
+            }
+            busAutotune = true;
+            tuneWindowStart = hal_millis();
+            tuneErrors = bus_errors();
+            tuneCleanSince = tuneWindowStart;
+            tuneLastRaise = tuneWindowStart - 2 * THERMAL_AUTOTUNE_WINDOW_MS;
+            tuneRaiseDelay = THERMAL_AUTOTUNE_CLEAN_MS;
+            apply_bus_clock(busClocks[busClockIndex]);
+        }
+        return true;
+    }
+
+    if (khz < 100 || khz > 1000)
+    {
+        return false;
+    }
+    busAutotune = false;
+    apply_bus_clock(khz);
+    return true;
+}
+
+/**
+ * Lower the bus clock on bursts of errors, and raise it again after a period
+ * without errors, see THERMAL_AUTOTUNE_WINDOW_MS.
+ */
+static void autotune_bus_clock(void)
+{
+    unsigned long now = hal_millis();
+    if (now - tuneWindowStart < THERMAL_AUTOTUNE_WINDOW_MS)
+    {
+        return;
+    }
+    uint32_t errors = bus_errors();
+    uint32_t windowErrors = errors - tuneErrors;
+    tuneWindowStart = now;
+    tuneErrors = errors;
+
+    if (windowErrors >= THERMAL_AUTOTUNE_ERRORS && busClockIndex + 1 < BUS_CLOCK_COUNT)
+    {
+        if (now - tuneLastRaise <= 2 * THERMAL_AUTOTUNE_WINDOW_MS && tuneRaiseDelay < 8 * THERMAL_AUTOTUNE_CLEAN_MS)
+        {
+            // Raising the clock just didn't work out, so wait longer next time
+            tuneRaiseDelay *= 2;
+        }
+        busClockIndex++;
+        apply_bus_clock(busClocks[busClockIndex]);
+        hal_printf("I2C: %lu errors, lowered clock to %u kHz\n", (unsigned long)windowErrors, busClock);
+    }
+    else if (windowErrors == 0 && busClockIndex > 0 && now - tuneCleanSince >= tuneRaiseDelay)
+    {
+        busClockIndex--;
+        apply_bus_clock(busClocks[busClockIndex]);
+        tuneLastRaise = now;
+        hal_printf("I2C: no errors, raised clock to %u kHz\n", busClock);
+    }
+    else if (windowErrors == 0)
+    {
+        return;
+    }
+    tuneCleanSince = now;
+}
+
+bool hal_thermal_acquire(void)
+{
+    static bool havePage[] = {false, false};
+
+    if (!ready)
+    {
+        return false;
+    }
+
+    if (busAutotune)
+    {
+        autotune_bus_clock();
+    }
+
+#if !THERMAL_CAPTURE_TIMER
+    unsigned long start = hal_micros();
+    while (capture() && hal_micros() - start < THERMAL_TICK_BUDGET_US)
+    {
+    }
+#endif
+
+    // While recording, all frames are recorded but only the newest is
+    // calculated when using THERMAL_QUEUE_LATEST. In step mode, both sub-pages
+    // of a triggered frame are always needed.
+    bool step = captureMode == THERMAL_CAPTURE_STEP;
+    bool latest = queuePolicy == THERMAL_QUEUE_LATEST && !step;
+    int slot = hal_ring_read_slot(&queue, latest && recorder == NULL);
+    if (slot < 0)
+    {
+        return false;
+    }
+    bool complete;
+    do
+    {
+        memcpy(MLX90641Frame, queuedFrames[slot], sizeof(MLX90641Frame));
+        complete = queuedComplete[slot];
+        acquiredSequence = queuedSequence[slot];
+        acquiredTimes = queuedFrameTimes[slot];
+        // Replaces a frame that wasn't calculated yet
+        acquired = false;
+        record_frame(queuedTimes[slot], MLX90641Frame);
+        hal_ring_release(&queue);
+    } while (latest && recorder != NULL && (slot = hal_ring_read_slot(&queue, false)) >= 0);
+
+    int subPage = MLX90641Frame[241];
+    havePage[subPage] = true;
+    if (!step && (!havePage[0] || !havePage[1]))
+    {
+        // Need to have seen both subpages before we can calculate anything
+        return false;
+    }
+
+    // First page after power-up is apparently always bogus, so skip it
+    static bool firstPage = true;
+    if (!step && firstPage)
+    {
+        firstPage = false;
+        havePage[0] = false;
+        havePage[1] = false;
+        return false;
+    }
+
+    acquired = true;
+    acquiredComplete = complete;
+    return true;
+}
+
+void hal_thermal_get_frame_times(ThermalFrameTimes *times)
+{
+    *times = acquiredTimes;
+}
+
+bool hal_thermal_frame_pending(void)
+{
+    return ready && hal_ring_count(&queue) > 0;
+}
+
+bool hal_thermal_calculate(float pixels[THERMAL_COLS * THERMAL_ROWS], float emissivity, bool auto_tr, float *tr)
+{
+    if (!acquired)
+    {
+        return false;
+    }
+    acquired = false;
+
+    // Decode Vdd, Ta etc. only once, also used by hal_thermal_recompute()
+    MLX90641_GetFrameContext(MLX90641Frame, &MLX90641, &MLX90641Context);
+    haveFrame = true;
+
+    int subPage = MLX90641Frame[241];
+    calculate(pixels, emissivity, auto_tr, tr);
+    fuse(pixels, subPage, acquiredSequence);
+
+#if THERMAL_STATS_INTERVAL > 0
+    static unsigned int statsFrames = 0;
+    if (++statsFrames >= THERMAL_STATS_INTERVAL)
+    {
+        statsFrames = 0;
+        sceneCacheStatsMLX90641 stats;
+        MLX90641_GetSceneCacheStats(&stats);
+        uint32_t total = stats.hits + stats.misses;
+        hal_printf("scene cache: hits=%lu misses=%lu (%lu%%)\n", (unsigned long)stats.hits,
+                   (unsigned long)stats.misses, total > 0 ? (unsigned long)(100ULL * stats.hits / total) : 0UL);
+
+        ThermalCaptureStats captureStats;
+        hal_thermal_get_capture_stats(&captureStats);
+        hal_printf("capture: frames=%lu overruns=%lu skipped=%lu errors=%lu\n",
+                   (unsigned long)captureStats.captured, (unsigned long)captureStats.overruns,
+                   (unsigned long)captureStats.skipped, (unsigned long)captureStats.errors);
+
+        ThermalBusStats busStats;
+        hal_thermal_get_bus_stats(&busStats);
+        hal_printf("bus: clock=%ukHz transactions=%lu nacks=%lu invalid=%lu retries=%lu lost=%lu\n",
+                   busStats.clock_khz, (unsigned long)busStats.transactions, (unsigned long)busStats.nacks,
+                   (unsigned long)busStats.invalid_frames, (unsigned long)busStats.retries,
+                   (unsigned long)busStats.lost_frames);
+
+        mlx90641_platform_print_stats();
+    }
+#endif
+
+    // In step mode, the first sub-page is only kept for fusion
+    return captureMode != THERMAL_CAPTURE_STEP || acquiredComplete;
+}
+
+bool hal_thermal_tick(float pixels[THERMAL_COLS * THERMAL_ROWS], float emissivity, bool auto_tr, float *tr)
+{
+    return hal_thermal_acquire() && hal_thermal_calculate(pixels, emissivity, auto_tr, tr);
+}
+
+bool hal_thermal_recompute(float pixels[THERMAL_COLS * THERMAL_ROWS], float emissivity, bool auto_tr, float *tr)
+{
+    if (acquired)
+    {
+        // Newer frame is waiting, which uses the new settings anyway
+        return hal_thermal_calculate(pixels, emissivity, auto_tr, tr);
+    }
+    if (!haveFrame)
+    {
+        return false;
+    }
+
+    calculate(pixels, emissivity, auto_tr, tr);
+
+    // Other sub-page's result was calculated using the previous settings
+    int subPage = MLX90641Frame[241];
+    haveResult[!subPage] = false;
+    fuse(pixels, subPage, acquiredSequence);
+    return true;
+}
+
+void hal_thermal_set_queue_policy(ThermalQueuePolicy policy)
+{
+    queuePolicy = policy;
+}
+
+void hal_thermal_get_capture_stats(ThermalCaptureStats *stats)
+{
+    stats->captured = capturedCount;
+    stats->overruns = __atomic_load_n(&queue.overruns, __ATOMIC_RELAXED);
+    stats->skipped = queue.skipped;
+    stats->errors = errorCount;
+}
+
+void hal_thermal_get_bus_stats(ThermalBusStats *stats)
+{
+    Mlx90641BusStats busStats;
+    mlx90641_platform_get_bus_stats(&busStats);
+    stats->transactions = busStats.transactions;
+    stats->bytes = busStats.bytes;
+    stats->nacks = busStats.nacks;
+    stats->invalid_frames = invalidCount;
+    stats->retries = retryCount;
+    stats->lost_frames = lostCount;
+    stats->clock_khz = busClock;
+}
@@ -0,0 +1,71 @@
+#ifndef MLX90641_PLATFORM_H
+#define MLX90641_PLATFORM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Platform-specific parts of the MLX90641 thermal HAL (hal_thermal.c in this
+ * directory). Each platform also provides the MLX90641_I2C_Driver.h functions.
+ */
+
+/**
+ * Set up the I2C bus. Its clock is set afterwards, using MLX90641_I2CFreqSet().
+ */
+void mlx90641_platform_init(void);
+
+/**
+ * Check whether a device responds at the given address.
+ */
+bool mlx90641_platform_probe(uint8_t slave_addr);
+
+typedef void (*Mlx90641CaptureCallback)(void);
+
+/**
+ * Start calling `capture` every `period_us` microseconds in the background
+ * (e.g. from a timer interrupt), independent of the main loop.
+ */
+void mlx90641_platform_capture_start(Mlx90641CaptureCallback capture, unsigned long period_us);
+
+/**
+ * Stop calling the capture callback. No-op if not started.
+ */
+void mlx90641_platform_capture_stop(void);
+
+/**
+ * Prevent the capture callback from running, e.g. while the main loop uses
+ * the I2C bus.
+ */
+void mlx90641_platform_capture_pause(void);
+
+/**
+ * Undo `mlx90641_platform_capture_pause()`.
+ */
+void mlx90641_platform_capture_resume(void);
+
+typedef struct Mlx90641BusStats
+{
+    uint32_t transactions; // I2C transactions, i.e. address phases
+    uint32_t bytes;        // Bytes transferred, including addresses
+    uint32_t nacks;        // Transactions that weren't acknowledged or completed
+} Mlx90641BusStats;
+
+/**
+ * Get counters of the MLX90641_I2C_Driver.h functions, since startup.
+ */
+void mlx90641_platform_get_bus_stats(Mlx90641BusStats *stats);
+
+/**
+ * Print platform-specific statistics, see THERMAL_STATS_INTERVAL.
+ */
+void mlx90641_platform_print_stats(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*MLX90641_PLATFORM_H*/
@@ -0,0 +1,48 @@
+#ifndef MLX90641_RECORDING_H
+#define MLX90641_RECORDING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * Binary format of raw sensor recordings, as written by
+ * `hal_thermal_start_recording()` and replayed by the simulator.
+ *
+ * A recording is a Mlx90641RecordingHeader, followed by any number of
+ * Mlx90641RecordingFrame. All values are little-endian, without padding.
+ * Frames hold the data as read from the sensor, so they can be processed by
+ * the normal calculation path using the calibration data in the header.
+ */
+
+#define MLX90641_RECORDING_MAGIC (0x52584c4d) // "MLXR"
+#define MLX90641_RECORDING_VERSION 1
+
+#define MLX90641_RECORDING_EEPROM_WORDS 832
+#define MLX90641_RECORDING_FRAME_WORDS 242
+
+typedef struct Mlx90641RecordingHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t eeprom_words; // MLX90641_RECORDING_EEPROM_WORDS
+    uint16_t frame_words;  // MLX90641_RECORDING_FRAME_WORDS
+    uint16_t reserved;
+    // EEPROM contents as read from the sensor (i.e. including Hamming code)
+    uint16_t eeprom[MLX90641_RECORDING_EEPROM_WORDS];
+} Mlx90641RecordingHeader;
+
+typedef struct Mlx90641RecordingFrame
+{
+    uint32_t time_ms; // Capture time, relative to start of recording
+    // As returned by MLX90641_GetFrameData(), including the sub-page number
+    uint16_t data[MLX90641_RECORDING_FRAME_WORDS];
+} Mlx90641RecordingFrame;
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*MLX90641_RECORDING_H*/
@@ -1,930 +0,0 @@
-#include <hal_thermal.h>
-
-static const float thermal_frames[][THERMAL_ROWS * THERMAL_COLS] = {
-    {19.96, 20.27, 21.03, 20.90, 21.05, 21.10, 21.31, 21.46, 21.45, 21.25, 21.13, 21.13, 20.96, 20.97, 21.18, 20.87,
-     20.87, 21.32, 21.22, 21.33, 21.41, 21.56, 21.61, 21.87, 21.34, 21.73, 21.38, 21.37, 21.47, 21.17, 21.02, 21.26,
-     21.27, 20.98, 21.05, 21.24, 21.66, 21.64, 21.61, 21.51, 21.61, 21.49, 21.50, 21.31, 21.46, 21.61, 21.08, 21.59,
-     21.30, 21.22, 21.13, 21.53, 21.66, 21.66, 21.72, 21.72, 21.71, 21.64, 21.57, 21.63, 21.63, 21.57, 21.21, 21.42,
-     21.32, 21.62, 21.33, 21.58, 21.77, 21.82, 21.80, 21.76, 21.72, 21.71, 21.82, 21.60, 21.57, 21.59, 21.06, 21.73,
-     21.58, 21.55, 21.88, 22.10, 22.99, 22.18, 21.84, 21.69, 21.68, 21.60, 21.55, 21.50, 21.53, 21.35, 21.40, 21.36,
-     21.74, 21.88, 22.03, 23.92, 30.90, 30.24, 24.01, 21.68, 21.53, 21.75, 21.52, 21.67, 21.37, 21.58, 21.58, 21.34,
-     21.77, 21.77, 22.62, 24.65, 31.19, 32.41, 29.25, 21.80, 21.56, 21.63, 21.48, 21.63, 21.68, 21.48, 21.51, 21.44,
-     21.94, 22.07, 22.57, 25.29, 32.90, 32.58, 30.80, 22.54, 21.51, 21.69, 21.57, 21.63, 21.55, 21.58, 21.53, 21.50,
-     22.21, 22.10, 22.56, 24.48, 31.14, 32.92, 31.21, 23.13, 23.26, 25.05, 25.49, 25.59, 24.83, 24.09, 24.53, 26.00,
-     21.68, 21.54, 22.19, 23.40, 26.22, 32.00, 30.89, 26.67, 26.71, 26.82, 28.16, 27.38, 26.72, 26.71, 27.10, 27.13,
-     20.58, 21.55, 23.26, 25.08, 27.14, 28.98, 26.40, 27.20, 26.66, 26.47, 28.66, 27.90, 27.93, 27.84, 27.69, 26.67},
-    {21.35, 21.09, 21.43, 21.68, 21.76, 21.40, 21.65, 21.75, 21.80, 21.72, 21.68, 21.73, 21.82, 21.44, 21.65, 22.30,
-     20.98, 21.17, 21.87, 21.91, 21.88, 21.67, 21.97, 21.73, 21.60, 21.69, 21.60, 21.85, 22.05, 21.10, 21.43, 21.85,
-     21.97, 21.42, 21.64, 21.93, 22.08, 21.80, 21.84, 21.97, 21.71, 21.77, 21.75, 21.84, 21.69, 22.07, 21.61, 21.77,
-     21.88, 21.44, 21.69, 22.31, 22.11, 21.85, 21.99, 21.90, 21.89, 21.90, 21.90, 22.03, 21.80, 21.82, 21.98, 22.25,
-     21.79, 21.82, 22.14, 21.94, 22.10, 21.91, 22.14, 21.97, 22.17, 22.09, 22.00, 21.94, 22.04, 21.88, 21.87, 22.04,
-     21.82, 21.81, 22.28, 22.71, 23.94, 23.15, 22.09, 21.89, 21.81, 21.84, 21.90, 21.88, 21.89, 21.74, 21.80, 22.27,
-     22.05, 21.82, 22.55, 24.37, 31.64, 31.37, 25.37, 22.00, 21.73, 22.03, 21.99, 21.68, 21.83, 21.86, 22.04, 22.11,
-     21.94, 22.50, 22.98, 25.15, 31.62, 32.84, 30.52, 22.42, 21.65, 21.84, 21.75, 21.64, 21.79, 22.13, 21.85, 21.93,
-     22.36, 22.41, 23.23, 25.71, 33.39, 32.99, 31.32, 23.21, 21.80, 21.78, 21.67, 21.97, 21.87, 21.94, 22.01, 21.83,
-     22.13, 22.33, 23.01, 24.60, 31.38, 33.18, 31.65, 23.86, 23.79, 25.28, 25.54, 25.80, 24.79, 23.48, 23.90, 24.83,
-     21.94, 22.11, 22.76, 23.65, 26.67, 32.15, 31.46, 27.11, 26.91, 26.97, 28.47, 27.65, 27.15, 26.79, 27.34, 27.59,
-     22.35, 22.14, 23.43, 26.03, 27.52, 29.37, 27.02, 27.69, 26.93, 27.01, 29.29, 28.44, 28.27, 28.13, 28.04, 27.97},
-    {20.49, 20.91, 21.04, 20.98, 21.25, 21.53, 21.43, 21.52, 21.52, 21.32, 21.38, 21.54, 21.18, 21.45, 21.28, 20.88,
-     20.98, 21.25, 21.23, 21.40, 21.48, 21.41, 21.61, 21.73, 21.65, 21.59, 21.39, 21.32, 21.41, 21.18, 21.35, 21.46,
-     21.28, 21.64, 21.19, 21.71, 21.72, 21.70, 21.75, 21.70, 21.85, 21.72, 21.65, 21.32, 21.53, 21.49, 21.54, 21.00,
-     21.56, 21.64, 21.51, 21.76, 21.87, 21.76, 21.90, 21.82, 21.77, 21.77, 21.72, 21.68, 21.70, 21.58, 21.43, 21.59,
-     21.17, 21.95, 21.57, 21.94, 21.92, 21.82, 21.89, 21.85, 21.73, 21.72, 21.66, 21.56, 21.89, 21.54, 21.61, 21.81,
-     21.74, 21.75, 22.00, 22.66, 24.57, 23.78, 21.85, 21.77, 21.93, 21.69, 21.77, 21.74, 21.69, 21.52, 21.80, 21.59,
-     21.75, 21.89, 22.15, 24.27, 31.69, 31.91, 26.32, 21.80, 21.62, 21.60, 21.62, 21.63, 21.53, 21.53, 21.72, 21.42,
-     21.39, 22.11, 22.63, 25.10, 31.45, 32.84, 30.75, 22.34, 21.93, 21.68, 21.67, 21.59, 21.64, 21.72, 21.65, 21.37,
-     21.63, 21.94, 22.58, 25.45, 33.21, 32.75, 31.36, 23.05, 21.80, 21.86, 21.49, 21.54, 21.82, 21.71, 21.67, 22.22,
-     21.95, 21.75, 22.76, 24.26, 31.14, 32.93, 31.56, 24.04, 23.40, 25.19, 25.63, 25.50, 24.73, 23.30, 24.04, 24.83,
-     21.31, 21.63, 22.06, 23.65, 26.72, 32.29, 30.86, 27.10, 26.63, 27.16, 28.42, 27.49, 26.79, 26.33, 26.88, 27.23,
-     21.59, 21.66, 23.19, 25.83, 27.27, 29.32, 26.91, 27.37, 26.83, 26.85, 28.95, 27.79, 28.07, 27.92, 27.45, 27.38},
-    {21.35, 21.27, 20.95, 21.26, 21.70, 21.70, 21.48, 21.64, 21.52, 21.72, 21.68, 21.34, 21.89, 21.52, 21.28, 21.43,
-     21.90, 21.73, 21.44, 21.59, 21.93, 21.73, 21.82, 21.78, 22.20, 21.79, 21.71, 21.67, 21.80, 21.39, 21.51, 21.37,
-     21.97, 21.42, 21.64, 21.65, 22.24, 21.89, 21.71, 21.88, 21.80, 21.95, 21.61, 21.68, 21.75, 21.62, 21.91, 22.03,
-     21.96, 21.99, 21.75, 21.93, 22.35, 22.03, 22.03, 21.78, 21.94, 21.95, 21.86, 21.78, 21.75, 21.70, 21.57, 21.92,
-     21.95, 21.95, 22.14, 22.10, 22.06, 22.12, 21.97, 21.97, 21.85, 21.88, 21.70, 21.94, 22.04, 22.06, 21.74, 21.82,
-     21.97, 22.07, 22.34, 22.66, 25.46, 24.48, 21.97, 21.85, 22.12, 22.12, 21.64, 21.65, 21.94, 21.57, 21.87, 21.67,
-     22.35, 22.02, 22.55, 24.81, 32.18, 32.06, 26.66, 21.88, 21.93, 21.79, 21.74, 21.72, 21.73, 21.59, 21.46, 21.96,
-     22.40, 22.57, 22.98, 25.50, 31.79, 33.08, 30.90, 22.54, 21.93, 22.00, 21.62, 21.69, 22.05, 21.95, 21.58, 22.01,
-     22.28, 22.61, 23.17, 25.81, 33.52, 32.99, 31.52, 23.13, 21.76, 21.82, 21.67, 21.88, 21.77, 21.82, 21.46, 21.83,
-     22.22, 22.99, 22.95, 24.82, 31.48, 33.23, 31.73, 23.90, 23.62, 25.54, 25.77, 25.95, 25.07, 24.10, 24.04, 24.83,
-     22.19, 22.35, 23.18, 23.53, 26.94, 32.43, 31.37, 27.11, 27.00, 27.30, 28.32, 27.55, 27.09, 27.11, 27.34, 27.14,
-     24.30, 22.73, 23.97, 26.10, 27.64, 29.59, 26.85, 27.32, 26.88, 27.22, 29.06, 28.32, 28.60, 28.06, 27.62, 27.62},
-    {21.35, 20.82, 21.20, 21.54, 21.57, 21.41, 21.54, 21.69, 21.68, 21.55, 21.38, 21.86, 21.82, 21.53, 21.47, 21.54,
-     21.70, 21.33, 21.51, 21.66, 21.65, 21.94, 21.72, 21.69, 21.70, 21.74, 21.71, 21.67, 21.35, 21.39, 21.43, 21.75,
-     21.71, 21.79, 21.52, 21.93, 21.93, 22.13, 22.07, 21.74, 22.03, 21.81, 21.70, 21.74, 22.09, 21.75, 21.47, 21.43,
-     21.72, 21.71, 21.57, 21.65, 22.15, 22.21, 21.82, 21.90, 21.94, 21.82, 21.76, 21.78, 21.96, 21.88, 21.78, 21.67,
-     21.87, 21.82, 21.97, 22.10, 22.05, 22.21, 21.85, 21.97, 21.97, 21.93, 21.79, 21.70, 21.83, 21.89, 21.54, 22.04,
-     22.28, 22.27, 22.11, 23.11, 25.37, 24.65, 22.17, 21.78, 22.12, 21.96, 21.68, 21.83, 21.94, 21.63, 21.48, 21.52,
-     22.05, 22.27, 22.38, 25.05, 32.26, 32.22, 26.93, 21.88, 21.77, 21.84, 21.91, 21.95, 21.83, 21.70, 21.78, 21.81,
-     21.78, 21.98, 22.92, 25.35, 31.75, 32.88, 31.02, 22.78, 21.85, 21.80, 21.62, 21.82, 21.84, 21.95, 21.79, 21.85,
-     22.04, 22.28, 23.05, 25.76, 33.47, 32.87, 31.36, 22.93, 22.05, 21.78, 21.90, 21.73, 21.93, 21.94, 21.74, 21.59,
-     22.22, 22.26, 22.57, 24.60, 31.48, 33.32, 31.56, 24.08, 23.53, 25.72, 25.91, 25.80, 24.90, 23.79, 23.90, 24.58,
-     22.69, 22.12, 22.48, 23.65, 26.88, 32.25, 31.32, 27.39, 26.77, 27.06, 28.32, 27.97, 27.21, 26.98, 26.88, 27.32,
-     22.84, 22.73, 23.97, 26.09, 27.88, 29.32, 26.96, 27.53, 27.03, 27.17, 28.89, 28.55, 28.20, 28.27, 27.79, 27.50},
-    {21.45, 21.05, 20.76, 20.81, 21.55, 21.50, 21.35, 21.56, 21.72, 21.36, 21.24, 21.38, 21.51, 21.18, 21.25, 21.28,
-     21.45, 21.46, 21.35, 21.51, 21.57, 21.71, 21.39, 21.67, 21.54, 21.82, 21.58, 21.54, 21.58, 21.15, 21.24, 21.72,
-     21.59, 21.54, 21.24, 21.57, 21.81, 21.88, 21.69, 21.78, 21.93, 21.71, 21.69, 21.51, 21.73, 21.15, 21.51, 21.22,
-     21.85, 21.62, 21.61, 21.63, 22.04, 21.88, 21.89, 21.98, 21.88, 21.59, 21.62, 21.62, 21.84, 21.38, 21.68, 21.56,
-     21.92, 21.93, 21.78, 22.03, 21.95, 21.98, 21.75, 21.76, 21.80, 21.75, 21.77, 21.69, 21.57, 21.29, 21.18, 21.79,
-     21.72, 21.79, 21.98, 22.70, 25.35, 24.55, 21.87, 21.76, 21.88, 21.83, 21.54, 21.73, 21.83, 21.55, 21.52, 21.56,
-     21.80, 22.06, 22.53, 24.74, 32.12, 32.05, 26.61, 21.87, 21.72, 21.78, 21.52, 21.62, 21.56, 21.79, 21.30, 21.55,
-     21.68, 22.41, 22.84, 25.19, 31.74, 32.71, 30.74, 22.41, 21.72, 21.87, 21.57, 21.49, 21.78, 21.76, 21.63, 21.66,
-     21.93, 22.19, 22.91, 25.69, 33.25, 32.74, 31.43, 23.04, 21.79, 21.68, 21.61, 21.72, 21.80, 21.86, 21.51, 21.56,
-     22.10, 22.23, 22.41, 24.58, 31.08, 33.04, 31.59, 23.89, 23.65, 25.40, 25.67, 25.93, 24.77, 23.34, 23.65, 24.12,
-     21.51, 22.32, 22.32, 23.69, 26.76, 32.37, 31.26, 27.23, 26.85, 26.95, 27.95, 27.37, 26.77, 26.43, 27.01, 27.02,
-     23.72, 22.11, 23.56, 25.67, 27.38, 29.46, 26.83, 27.46, 26.81, 26.89, 28.76, 28.36, 28.11, 27.89, 27.33, 27.10},
-    {21.27, 20.96, 21.09, 21.09, 21.17, 21.45, 21.47, 21.22, 21.44, 21.42, 21.48, 21.18, 21.29, 21.02, 21.25, 21.17,
-     21.04, 21.38, 21.35, 21.38, 21.63, 21.71, 21.65, 21.77, 21.68, 21.67, 21.48, 21.42, 21.71, 21.15, 21.24, 21.33,
-     21.50, 21.18, 21.88, 21.40, 22.01, 21.83, 21.69, 21.46, 21.88, 21.57, 21.78, 21.51, 21.34, 21.40, 21.51, 21.22,
-     21.61, 21.55, 21.61, 21.69, 21.85, 21.61, 21.76, 21.81, 21.75, 21.76, 21.48, 21.67, 21.68, 21.50, 21.61, 21.56,
-     21.53, 21.54, 21.95, 21.88, 22.09, 22.07, 21.84, 21.92, 21.96, 21.75, 21.69, 21.78, 21.92, 21.40, 21.45, 21.32,
-     22.09, 21.99, 22.20, 22.90, 25.57, 24.92, 22.12, 21.76, 21.72, 21.68, 21.59, 21.63, 21.52, 21.50, 21.45, 21.49,
-     22.10, 21.93, 22.25, 24.79, 32.12, 32.05, 26.84, 21.91, 21.92, 21.74, 21.60, 21.62, 21.76, 21.51, 21.24, 21.47,
-     21.75, 22.15, 22.84, 25.43, 31.44, 32.68, 30.97, 22.53, 21.80, 21.79, 21.61, 21.53, 21.37, 21.70, 21.69, 21.58,
-     21.92, 22.46, 22.67, 25.48, 33.20, 32.78, 31.31, 22.67, 21.83, 21.68, 21.75, 21.28, 21.54, 21.98, 21.65, 21.56,
-     22.09, 22.38, 22.80, 24.30, 30.98, 33.30, 31.67, 24.16, 23.47, 25.35, 25.67, 25.68, 24.60, 22.97, 23.29, 23.51,
-     22.13, 22.08, 21.97, 23.57, 26.86, 32.28, 31.26, 27.18, 26.80, 27.05, 28.10, 27.47, 26.89, 26.24, 26.55, 26.83,
-     22.71, 22.30, 23.79, 25.80, 27.31, 29.46, 26.78, 27.30, 27.02, 26.83, 29.04, 28.24, 27.98, 27.67, 26.98, 26.86},
-    {19.79, 21.17, 21.19, 21.40, 21.57, 21.40, 21.65, 21.52, 21.35, 21.54, 21.62, 21.53, 21.25, 21.12, 21.55, 21.65,
-     21.79, 21.16, 21.44, 21.65, 21.64, 21.98, 21.81, 21.53, 21.60, 21.83, 21.60, 21.55, 21.66, 21.38, 21.59, 21.75,
-     21.45, 21.49, 21.51, 21.81, 21.82, 21.89, 21.70, 21.92, 21.71, 21.62, 21.55, 21.73, 21.52, 21.68, 21.53, 21.60,
-     21.80, 21.50, 21.87, 21.92, 21.91, 21.84, 22.03, 21.81, 21.84, 21.68, 21.71, 21.68, 21.85, 21.63, 21.56, 21.75,
-     21.87, 21.75, 21.85, 22.50, 22.14, 21.82, 21.72, 22.05, 21.96, 21.75, 21.74, 21.70, 21.78, 21.65, 21.53, 21.81,
-     21.59, 22.13, 22.11, 23.01, 25.93, 25.09, 22.20, 22.09, 21.92, 21.72, 21.81, 21.96, 21.84, 21.29, 21.47, 21.81,
-     21.75, 22.14, 22.60, 24.95, 31.96, 32.24, 27.22, 22.00, 21.77, 21.87, 21.86, 21.76, 21.57, 21.69, 21.84, 22.10,
-     22.16, 22.17, 22.80, 25.45, 31.36, 32.56, 31.04, 22.70, 21.73, 21.67, 21.62, 21.86, 21.69, 21.83, 21.84, 21.92,
-     21.63, 22.41, 22.69, 25.50, 33.21, 32.94, 31.32, 23.13, 21.88, 21.81, 21.80, 21.73, 21.71, 21.76, 21.25, 21.74,
-     22.30, 22.18, 22.75, 24.08, 30.85, 33.05, 31.81, 24.30, 23.48, 25.36, 25.95, 25.64, 24.45, 22.98, 23.31, 23.97,
-     21.94, 21.95, 22.83, 23.71, 26.82, 32.19, 31.50, 27.33, 26.77, 26.91, 28.21, 27.70, 26.79, 26.45, 27.11, 27.05,
-     23.81, 22.24, 23.89, 25.89, 27.51, 29.31, 26.79, 27.47, 26.87, 26.74, 29.05, 28.26, 27.93, 27.91, 28.04, 27.73},
-    {20.66, 20.73, 21.03, 21.40, 21.19, 21.46, 21.59, 21.69, 21.51, 21.66, 21.62, 21.01, 21.46, 21.52, 21.28, 21.32,
-     21.79, 21.73, 21.37, 21.33, 21.87, 21.51, 21.76, 21.73, 21.64, 21.68, 21.54, 21.32, 21.60, 21.03, 20.86, 21.56,
-     21.62, 21.49, 21.70, 21.42, 21.92, 21.70, 21.79, 21.69, 21.84, 21.76, 21.65, 21.57, 21.69, 21.42, 21.24, 21.69,
-     21.88, 21.64, 21.75, 21.92, 21.72, 21.71, 21.94, 21.81, 21.97, 21.81, 21.71, 21.58, 21.85, 21.87, 21.43, 21.50,
-     22.02, 21.82, 21.85, 22.09, 21.96, 21.91, 21.97, 21.88, 21.80, 21.92, 21.82, 21.70, 21.88, 21.53, 21.47, 21.50,
-     21.66, 22.20, 22.50, 22.96, 25.89, 25.17, 22.04, 21.81, 21.92, 21.68, 21.85, 21.69, 21.73, 21.46, 21.14, 21.51,
-     22.12, 22.08, 22.49, 24.70, 31.92, 32.40, 27.41, 21.80, 21.96, 21.59, 21.53, 21.72, 21.57, 21.69, 21.65, 21.72,
-     21.93, 22.30, 22.80, 25.00, 31.23, 32.76, 30.86, 22.33, 21.85, 21.80, 21.62, 21.77, 21.64, 21.60, 21.65, 21.61,
-     21.87, 22.34, 22.81, 25.19, 33.12, 32.86, 31.51, 22.88, 21.76, 21.82, 21.67, 21.58, 21.55, 21.70, 21.74, 21.42,
-     21.77, 22.33, 22.82, 24.14, 30.61, 33.22, 31.85, 24.08, 23.57, 25.54, 25.72, 25.59, 24.56, 23.05, 23.09, 23.54,
-     21.94, 22.19, 22.55, 23.52, 26.50, 32.24, 31.36, 27.15, 26.48, 27.01, 28.01, 27.43, 26.90, 26.39, 26.72, 27.22,
-     22.10, 22.73, 23.81, 25.82, 27.45, 29.31, 26.79, 27.10, 26.66, 27.22, 28.77, 28.20, 27.86, 27.84, 27.70, 27.38},
-    {20.75, 20.60, 20.84, 21.16, 21.29, 21.32, 21.12, 21.45, 21.39, 21.41, 21.18, 21.18, 21.22, 21.33, 20.41, 21.38,
-     21.14, 21.13, 21.06, 21.25, 21.34, 21.44, 21.44, 21.42, 21.73, 21.52, 21.58, 21.13, 21.45, 21.00, 20.49, 21.33,
-     21.24, 21.32, 21.04, 21.23, 21.75, 21.63, 21.37, 21.68, 21.83, 21.48, 21.39, 21.45, 21.33, 21.59, 21.28, 20.96,
-     21.28, 21.41, 21.54, 21.52, 21.66, 21.83, 21.62, 21.68, 21.62, 21.71, 21.38, 21.57, 21.57, 21.38, 20.98, 21.39,
-     21.45, 21.40, 21.83, 21.72, 21.99, 21.89, 21.67, 21.75, 21.71, 21.58, 21.60, 21.64, 21.61, 21.46, 21.18, 21.40,
-     21.41, 21.79, 22.03, 22.79, 25.70, 25.04, 22.03, 21.56, 21.72, 21.67, 21.54, 21.54, 21.62, 21.16, 21.25, 21.41,
-     21.57, 21.80, 22.41, 24.55, 31.71, 32.20, 26.91, 21.83, 21.56, 21.62, 21.43, 21.48, 21.46, 21.34, 21.43, 21.39,
-     21.59, 21.95, 22.60, 25.14, 30.89, 32.60, 30.81, 22.28, 21.64, 21.54, 21.52, 21.30, 21.67, 21.64, 21.62, 21.18,
-     21.43, 22.05, 22.55, 24.97, 32.94, 32.82, 31.27, 22.79, 21.71, 21.47, 21.43, 21.47, 21.48, 21.56, 21.30, 21.47,
-     21.56, 21.86, 22.15, 23.73, 30.26, 33.04, 31.50, 24.07, 23.25, 25.22, 25.66, 25.23, 24.15, 22.96, 22.85, 23.43,
-     21.37, 21.51, 22.10, 23.07, 26.37, 31.94, 31.26, 27.04, 26.52, 26.85, 27.80, 27.05, 26.65, 26.56, 26.62, 26.48,
-     22.95, 22.09, 23.16, 25.33, 27.31, 29.13, 26.99, 26.98, 26.76, 26.57, 28.25, 27.83, 27.51, 27.96, 26.72, 26.63},
-    {20.70, 20.89, 21.35, 21.41, 21.47, 21.73, 21.57, 21.50, 21.72, 21.69, 21.17, 21.55, 21.26, 21.21, 21.08, 20.62,
-     21.76, 21.81, 21.45, 21.68, 21.51, 21.76, 21.55, 21.68, 21.59, 21.68, 21.64, 21.70, 21.50, 21.26, 21.18, 21.63,
-     21.44, 21.65, 21.21, 21.57, 21.86, 21.98, 21.71, 21.74, 21.81, 21.54, 21.55, 21.77, 21.67, 21.77, 21.55, 21.42,
-     21.63, 21.73, 21.47, 21.79, 21.81, 21.85, 21.91, 21.70, 21.99, 21.78, 21.68, 21.68, 21.73, 21.37, 21.44, 21.50,
-     21.48, 21.45, 21.83, 22.24, 22.01, 22.22, 21.90, 21.82, 21.90, 21.85, 21.84, 21.75, 21.77, 21.51, 21.49, 21.59,
-     21.75, 21.84, 22.26, 22.95, 25.85, 25.23, 22.06, 21.99, 21.79, 21.94, 21.91, 21.74, 21.53, 21.39, 21.49, 21.59,
-     21.91, 21.97, 22.35, 24.70, 31.86, 32.15, 27.17, 21.86, 21.79, 21.69, 21.71, 21.68, 21.72, 21.46, 21.74, 21.50,
-     22.25, 22.13, 23.00, 25.29, 31.16, 32.62, 31.07, 22.67, 21.66, 21.73, 21.63, 21.55, 21.58, 21.64, 21.67, 21.29,
-     21.95, 22.10, 22.67, 25.33, 33.09, 32.96, 31.41, 22.98, 21.69, 21.79, 21.81, 21.53, 21.65, 21.44, 21.82, 21.82,
-     21.76, 22.19, 22.72, 24.18, 30.17, 33.06, 31.69, 24.48, 23.36, 25.46, 25.72, 25.54, 24.43, 23.01, 22.96, 23.71,
-     21.62, 21.71, 22.15, 23.68, 26.64, 31.95, 31.46, 27.62, 26.53, 27.01, 28.06, 27.36, 26.87, 26.67, 27.03, 27.39,
-     22.35, 22.02, 23.59, 25.57, 27.30, 29.35, 26.72, 27.19, 26.96, 27.10, 28.69, 28.05, 27.95, 28.06, 27.17, 27.67},
-    {20.97, 20.85, 21.08, 21.52, 21.44, 21.29, 21.83, 21.65, 21.75, 21.38, 21.68, 21.53, 21.23, 21.10, 21.59, 21.23,
-     20.90, 21.37, 21.71, 21.78, 21.77, 21.79, 21.89, 21.71, 21.77, 21.61, 21.72, 21.79, 21.41, 21.23, 21.31, 21.78,
-     21.49, 21.48, 21.83, 21.88, 21.94, 21.68, 21.92, 21.91, 21.83, 21.80, 21.87, 21.75, 21.53, 21.48, 21.81, 21.47,
-     21.84, 21.56, 21.94, 22.26, 22.18, 21.88, 22.15, 21.90, 21.76, 21.89, 21.79, 21.76, 21.66, 21.58, 21.55, 22.12,
-     21.69, 21.75, 22.09, 22.27, 22.08, 22.07, 22.13, 22.09, 21.73, 21.80, 21.95, 21.87, 21.65, 21.72, 21.73, 22.02,
-     22.02, 21.94, 22.46, 23.18, 25.88, 25.50, 22.17, 21.89, 21.89, 21.85, 22.15, 21.95, 21.81, 21.69, 21.73, 21.64,
-     21.96, 22.08, 22.61, 24.73, 31.80, 32.21, 27.41, 22.16, 21.86, 21.88, 21.82, 21.75, 21.75, 21.65, 21.84, 21.85,
-     21.83, 22.17, 22.86, 25.37, 31.01, 32.83, 31.31, 22.90, 21.93, 21.68, 21.70, 21.76, 21.66, 21.61, 22.04, 21.89,
-     21.60, 22.20, 22.82, 25.31, 33.02, 33.14, 31.59, 23.17, 21.72, 21.90, 21.88, 21.56, 21.62, 21.77, 21.52, 21.95,
-     21.91, 22.16, 22.75, 24.32, 30.44, 33.08, 32.09, 24.47, 23.61, 25.39, 25.84, 25.92, 24.63, 22.86, 23.22, 23.50,
-     22.45, 22.16, 22.75, 23.41, 26.35, 32.12, 31.58, 27.64, 26.61, 27.13, 28.04, 27.66, 26.79, 26.25, 27.08, 27.44,
-     23.25, 21.89, 23.79, 25.95, 27.40, 29.38, 27.24, 27.38, 26.84, 26.92, 28.89, 28.32, 27.92, 27.74, 27.56, 27.50},
-    {21.54, 21.10, 21.37, 21.27, 21.39, 21.42, 21.33, 21.54, 21.75, 21.50, 21.27, 21.55, 21.26, 21.38, 20.84, 21.12,
-     21.30, 21.75, 21.81, 21.48, 21.66, 21.79, 21.78, 21.79, 22.11, 21.65, 21.72, 21.39, 21.42, 21.33, 21.12, 21.48,
-     21.46, 21.80, 21.65, 21.66, 21.94, 22.10, 21.85, 21.75, 21.86, 21.50, 21.76, 21.64, 21.76, 21.76, 21.78, 21.36,
-     21.65, 21.79, 21.70, 21.77, 21.97, 21.86, 22.00, 21.79, 22.07, 21.87, 21.68, 21.65, 21.60, 21.59, 21.44, 21.77,
-     22.11, 22.09, 22.04, 22.26, 22.06, 22.14, 21.86, 21.94, 21.90, 21.85, 21.75, 21.62, 21.79, 21.55, 21.22, 21.67,
-     21.98, 21.96, 22.23, 22.67, 25.86, 25.64, 22.26, 21.94, 21.82, 21.82, 21.78, 21.52, 21.70, 21.59, 21.68, 21.68,
-     21.91, 22.16, 22.67, 24.23, 31.74, 32.34, 27.83, 21.89, 21.71, 21.73, 21.71, 21.78, 21.64, 21.54, 21.67, 21.66,
-     22.26, 22.25, 22.69, 25.31, 31.08, 32.85, 31.36, 22.75, 22.06, 21.85, 21.68, 21.56, 21.70, 21.85, 21.53, 21.46,
-     21.96, 22.43, 22.88, 24.84, 32.96, 33.16, 31.57, 23.27, 21.77, 21.87, 21.73, 21.69, 21.73, 21.72, 21.55, 21.60,
-     22.40, 22.34, 22.71, 24.33, 30.24, 33.37, 31.87, 24.49, 23.50, 25.29, 25.60, 25.61, 24.41, 23.06, 22.97, 23.22,
-     22.70, 22.45, 22.49, 23.42, 26.62, 32.30, 31.66, 27.72, 26.40, 27.07, 28.08, 27.34, 26.68, 26.40, 26.89, 27.06,
-     22.59, 22.74, 23.83, 25.97, 27.52, 29.65, 27.03, 27.16, 27.04, 26.81, 29.13, 28.45, 27.68, 27.93, 27.28, 27.39},
-    {21.34, 20.81, 20.79, 21.11, 21.69, 21.63, 21.31, 21.35, 21.57, 21.48, 21.32, 21.14, 21.67, 21.20, 20.91, 21.20,
-     21.59, 21.00, 21.51, 21.71, 22.04, 21.56, 21.51, 21.53, 21.55, 21.89, 21.38, 21.49, 21.60, 21.10, 21.34, 21.56,
-     21.10, 21.63, 21.51, 21.59, 21.71, 21.89, 21.70, 21.74, 21.84, 21.67, 21.65, 21.47, 21.75, 21.48, 21.61, 21.51,
-     21.39, 21.70, 21.50, 22.14, 22.25, 21.98, 21.72, 21.81, 21.85, 21.85, 21.67, 21.53, 21.80, 21.64, 21.56, 21.67,
-     21.94, 22.01, 21.85, 22.14, 22.00, 22.03, 21.80, 21.80, 21.96, 21.84, 21.61, 21.61, 21.88, 21.59, 21.60, 21.58,
-     21.74, 22.00, 22.22, 22.71, 25.98, 25.66, 22.00, 21.77, 21.96, 21.92, 21.77, 21.64, 21.94, 21.40, 21.34, 21.43,
-     21.75, 22.07, 22.37, 24.46, 31.81, 32.17, 27.67, 21.84, 21.69, 21.75, 21.57, 21.63, 21.48, 21.52, 21.52, 21.65,
-     22.55, 22.23, 22.68, 24.85, 30.82, 32.80, 31.13, 22.49, 21.89, 21.75, 21.53, 21.41, 21.79, 21.83, 21.58, 21.69,
-     22.11, 22.00, 22.63, 24.83, 32.96, 33.19, 31.44, 23.29, 22.04, 21.81, 21.53, 21.49, 21.39, 21.76, 21.32, 21.74,
-     22.03, 22.17, 22.36, 23.91, 29.89, 33.01, 31.81, 24.43, 23.31, 25.32, 25.72, 25.60, 24.39, 23.17, 22.73, 22.86,
-     22.04, 21.94, 22.12, 23.27, 26.44, 32.10, 31.32, 27.57, 26.39, 27.20, 27.82, 27.38, 26.97, 26.58, 26.50, 26.78,
-     23.53, 22.42, 23.34, 26.02, 27.39, 29.42, 27.06, 27.15, 26.88, 27.11, 28.83, 27.96, 28.00, 28.20, 27.10, 27.38},
-    {21.18, 20.82, 21.35, 21.47, 21.38, 21.64, 21.65, 21.63, 21.57, 21.32, 21.44, 21.33, 21.31, 21.29, 21.00, 20.88,
-     21.18, 21.73, 21.58, 21.72, 21.59, 21.88, 21.71, 21.73, 21.89, 21.48, 21.60, 21.49, 21.79, 21.32, 21.59, 21.94,
-     21.71, 21.49, 21.12, 21.81, 21.92, 21.94, 21.75, 21.74, 21.57, 21.95, 21.65, 21.57, 21.75, 21.55, 21.46, 21.51,
-     21.80, 21.71, 21.75, 21.59, 22.05, 21.98, 22.03, 21.98, 21.89, 21.77, 21.81, 21.83, 21.80, 21.94, 21.57, 21.67,
-     21.71, 21.75, 21.91, 22.04, 22.14, 22.12, 21.93, 21.88, 21.96, 21.76, 21.65, 21.70, 21.83, 21.82, 21.73, 21.58,
-     22.20, 22.01, 22.16, 22.96, 25.89, 25.75, 22.24, 21.97, 21.88, 21.80, 21.89, 21.64, 21.59, 21.63, 21.27, 21.66,
-     22.12, 22.27, 22.49, 24.51, 31.89, 32.33, 27.90, 22.00, 21.81, 21.83, 21.86, 21.94, 21.48, 21.25, 21.58, 21.72,
-     22.09, 22.56, 22.86, 25.00, 30.77, 33.00, 31.28, 23.02, 21.77, 21.63, 21.66, 21.59, 21.84, 21.72, 21.65, 21.76,
-     22.11, 22.35, 22.81, 24.83, 32.96, 33.19, 31.60, 23.29, 21.92, 21.69, 21.58, 21.63, 21.66, 21.88, 21.60, 21.74,
-     22.04, 22.11, 22.82, 24.09, 30.13, 33.01, 31.90, 24.34, 23.53, 25.19, 25.91, 25.65, 24.45, 22.99, 23.10, 23.46,
-     22.19, 21.87, 22.34, 23.59, 26.55, 32.24, 31.79, 27.48, 26.67, 27.01, 28.07, 27.49, 27.09, 26.59, 26.88, 26.96,
-     22.84, 22.24, 23.66, 25.62, 27.45, 29.37, 27.12, 27.26, 26.77, 27.06, 28.78, 28.26, 27.93, 27.99, 27.79, 27.61},
-    {20.59, 20.51, 21.47, 21.30, 21.29, 21.56, 21.46, 21.73, 21.72, 21.52, 21.36, 21.64, 21.22, 20.78, 21.06, 21.27,
-     21.24, 21.05, 21.41, 21.63, 21.45, 21.65, 21.39, 21.56, 21.53, 21.67, 21.63, 21.53, 21.39, 21.14, 21.23, 21.71,
-     21.50, 21.25, 21.10, 21.62, 21.90, 21.68, 21.60, 21.86, 21.56, 21.79, 21.78, 21.50, 21.50, 21.33, 21.65, 21.56,
-     21.36, 21.47, 21.85, 21.68, 21.85, 22.06, 21.93, 21.84, 21.57, 21.93, 21.65, 21.76, 21.51, 21.55, 21.61, 21.64,
-     21.45, 21.53, 22.00, 22.02, 21.90, 22.02, 21.83, 21.83, 21.67, 21.82, 21.68, 21.64, 21.71, 21.63, 21.58, 22.01,
-     21.87, 21.79, 22.20, 22.79, 25.79, 25.69, 22.23, 21.80, 21.79, 21.67, 21.71, 21.72, 21.42, 21.27, 21.45, 21.63,
-     21.50, 21.86, 22.41, 24.50, 31.50, 32.23, 27.77, 21.94, 21.56, 21.74, 21.72, 21.52, 21.41, 21.39, 21.95, 21.77,
-     21.68, 21.95, 22.78, 24.88, 30.50, 32.55, 31.30, 22.97, 21.63, 21.58, 21.56, 21.62, 21.72, 21.58, 21.35, 21.73,
-     21.93, 22.12, 22.79, 25.07, 32.81, 33.01, 31.54, 23.36, 21.74, 21.63, 21.61, 21.86, 21.74, 21.50, 21.64, 21.87,
-     21.31, 21.94, 22.60, 24.01, 29.87, 32.82, 31.96, 24.51, 23.29, 25.34, 25.84, 25.63, 24.26, 23.21, 23.07, 23.51,
-     22.15, 22.00, 22.46, 23.57, 26.48, 31.89, 31.72, 27.46, 26.52, 26.80, 28.10, 27.68, 26.94, 26.49, 26.85, 26.83,
-     21.28, 22.21, 23.56, 25.87, 27.49, 29.29, 27.16, 27.13, 26.65, 26.78, 28.87, 28.41, 28.24, 28.03, 27.32, 27.56},
-    {21.10, 21.05, 21.24, 21.37, 21.54, 21.74, 21.69, 21.67, 21.44, 21.64, 21.60, 21.64, 21.36, 21.65, 21.24, 21.71,
-     21.65, 21.62, 21.76, 21.56, 21.85, 21.65, 21.85, 21.61, 21.53, 21.62, 21.58, 21.64, 21.57, 21.22, 21.48, 21.32,
-     21.58, 21.68, 21.81, 21.62, 21.70, 21.82, 21.73, 21.63, 21.74, 21.88, 21.68, 21.87, 21.73, 21.65, 21.80, 22.25,
-     22.01, 21.68, 21.85, 21.74, 21.84, 21.97, 21.88, 22.14, 21.70, 22.01, 21.56, 21.91, 21.83, 21.79, 21.61, 21.80,
-     21.37, 22.12, 21.94, 22.07, 21.99, 22.24, 22.12, 21.99, 21.91, 21.91, 21.77, 21.82, 21.91, 21.69, 21.44, 21.70,
-     22.24, 22.11, 22.31, 22.84, 25.70, 25.69, 22.19, 22.03, 21.79, 21.83, 21.88, 21.81, 21.62, 21.61, 21.44, 21.78,
-     21.72, 22.05, 22.52, 24.30, 31.71, 32.39, 27.85, 21.90, 21.72, 21.82, 21.77, 21.66, 21.85, 21.62, 21.75, 21.69,
-     22.06, 22.21, 22.95, 24.78, 30.63, 32.83, 31.30, 22.85, 21.63, 21.74, 21.73, 21.71, 21.62, 21.58, 21.62, 21.26,
-     21.43, 22.25, 22.91, 24.96, 33.02, 33.17, 31.62, 23.24, 21.87, 21.68, 21.70, 21.61, 21.90, 21.68, 21.71, 21.79,
-     22.27, 22.15, 22.60, 23.89, 29.97, 33.08, 32.05, 24.55, 23.38, 25.35, 25.75, 25.48, 24.26, 22.90, 23.21, 23.42,
-     21.89, 22.00, 22.10, 23.56, 26.48, 32.18, 31.72, 27.60, 26.51, 26.99, 28.00, 27.57, 26.82, 26.36, 26.84, 26.92,
-     22.48, 22.10, 23.63, 26.13, 27.55, 29.35, 27.15, 27.13, 26.75, 26.93, 29.03, 28.11, 27.97, 28.17, 27.49, 27.79},
-    {20.86, 21.20, 21.29, 21.35, 21.59, 21.71, 21.44, 21.65, 21.76, 21.51, 21.10, 21.22, 21.41, 21.22, 21.12, 21.12,
-     21.92, 21.26, 21.46, 21.67, 21.66, 21.53, 21.94, 21.70, 21.66, 21.70, 21.67, 21.80, 21.87, 21.75, 21.69, 21.77,
-     21.30, 21.66, 21.72, 21.83, 21.79, 21.86, 21.81, 21.98, 22.04, 21.60, 21.77, 21.80, 21.60, 21.51, 21.78, 21.62,
-     21.33, 21.52, 21.95, 22.05, 21.93, 21.77, 21.91, 21.83, 21.78, 21.74, 21.73, 21.80, 21.76, 21.60, 21.72, 21.77,
-     21.89, 21.97, 21.81, 22.21, 22.02, 21.97, 22.07, 21.94, 21.78, 21.94, 21.84, 21.95, 21.80, 21.78, 21.89, 21.60,
-     21.99, 21.83, 22.46, 22.78, 25.73, 25.92, 22.26, 21.87, 21.98, 21.78, 21.70, 21.75, 21.66, 21.36, 21.36, 21.91,
-     21.92, 22.03, 22.68, 24.43, 31.65, 32.41, 28.06, 21.94, 21.83, 21.81, 21.63, 21.65, 21.69, 21.55, 21.93, 22.12,
-     21.96, 22.19, 22.53, 24.87, 30.66, 32.81, 31.36, 23.04, 21.79, 21.85, 21.72, 21.84, 21.55, 22.08, 21.86, 22.02,
-     22.06, 21.96, 22.89, 24.85, 33.10, 33.20, 31.73, 23.56, 21.78, 21.96, 21.69, 21.79, 21.57, 21.54, 21.75, 22.00,
-     21.89, 22.35, 22.65, 24.05, 30.10, 32.93, 31.91, 24.63, 23.37, 25.38, 25.88, 25.61, 24.24, 23.07, 22.90, 23.65,
-     22.09, 22.29, 22.57, 23.36, 26.68, 32.30, 31.43, 27.59, 26.74, 27.12, 28.08, 27.61, 26.63, 26.54, 27.05, 27.24,
-     23.62, 22.56, 23.84, 26.31, 27.41, 29.49, 27.14, 27.38, 26.63, 26.92, 28.96, 28.16, 27.88, 27.93, 27.46, 27.75},
-    {21.03, 20.57, 21.13, 21.20, 21.40, 21.54, 21.56, 21.48, 21.48, 21.39, 21.28, 21.16, 21.19, 20.83, 21.21, 20.90,
-     21.51, 21.43, 21.67, 21.61, 21.55, 21.42, 21.73, 21.55, 21.46, 21.70, 21.51, 21.45, 21.36, 21.19, 21.20, 21.29,
-     21.47, 21.22, 21.53, 21.66, 21.68, 21.81, 21.59, 21.48, 21.82, 21.55, 21.52, 21.43, 21.31, 21.51, 21.56, 21.01,
-     21.33, 21.59, 21.46, 21.77, 21.98, 21.73, 21.96, 21.87, 21.74, 21.79, 21.55, 21.80, 21.55, 21.48, 21.45, 21.60,
-     21.57, 21.77, 21.75, 21.75, 22.11, 22.01, 21.99, 21.98, 21.86, 21.73, 21.80, 21.53, 21.55, 21.50, 21.22, 21.67,
-     21.45, 22.09, 22.18, 22.88, 25.55, 25.68, 22.10, 21.67, 21.78, 21.82, 21.66, 21.61, 21.50, 21.31, 21.42, 21.91,
-     21.62, 21.84, 22.17, 24.33, 31.61, 32.22, 27.80, 21.90, 21.87, 21.65, 21.76, 21.74, 21.69, 21.44, 21.54, 21.67,
-     21.87, 22.19, 22.70, 24.77, 30.44, 32.70, 31.36, 22.80, 21.82, 21.65, 21.68, 21.65, 21.65, 21.45, 22.00, 21.31,
-     21.73, 22.03, 22.77, 24.95, 32.88, 33.00, 31.49, 23.39, 21.74, 21.67, 21.64, 21.41, 21.57, 21.72, 21.55, 21.52,
-     21.44, 22.13, 22.77, 23.99, 30.05, 33.11, 31.78, 24.54, 23.37, 25.38, 25.92, 25.51, 24.30, 22.88, 22.82, 23.13,
-     21.96, 22.05, 22.15, 23.23, 26.30, 32.16, 31.33, 27.40, 26.41, 26.88, 28.03, 27.34, 26.62, 26.54, 26.66, 26.79,
-     23.34, 22.16, 23.83, 25.84, 27.29, 29.27, 26.92, 27.01, 26.73, 27.08, 28.79, 27.86, 27.75, 27.79, 26.94, 27.28},
-    {20.94, 21.06, 21.48, 21.38, 21.37, 21.57, 21.75, 21.79, 21.67, 21.65, 21.61, 21.65, 21.30, 20.87, 21.25, 21.50,
-     21.46, 21.46, 21.63, 21.64, 21.69, 21.66, 21.86, 21.92, 21.79, 21.78, 21.80, 21.83, 21.65, 21.44, 21.24, 21.72,
-     21.34, 21.33, 21.75, 21.75, 21.76, 21.79, 21.97, 21.91, 21.75, 21.85, 21.74, 21.57, 21.68, 21.66, 21.74, 21.57,
-     21.45, 21.48, 21.61, 21.91, 21.86, 21.98, 21.98, 21.90, 21.63, 22.02, 22.03, 21.92, 21.68, 21.68, 21.89, 22.06,
-     21.69, 21.87, 22.07, 22.19, 22.05, 21.86, 21.97, 21.92, 21.92, 21.92, 21.95, 21.84, 21.92, 21.58, 21.79, 22.25,
-     21.72, 21.73, 22.32, 23.00, 25.80, 25.70, 22.40, 21.89, 21.73, 21.84, 21.98, 21.78, 21.63, 21.61, 21.72, 21.87,
-     21.66, 22.32, 22.59, 24.50, 31.72, 32.43, 27.89, 22.03, 21.81, 21.79, 21.74, 21.62, 21.62, 21.85, 22.02, 22.01,
-     22.07, 22.15, 22.96, 24.99, 30.64, 32.91, 31.46, 23.10, 22.05, 21.71, 21.92, 21.72, 21.68, 21.76, 22.09, 22.06,
-     21.85, 22.26, 23.03, 25.13, 32.77, 33.10, 31.67, 23.37, 21.84, 21.73, 21.75, 21.77, 21.97, 21.45, 21.92, 21.64,
-     22.10, 22.31, 23.06, 24.24, 30.22, 33.17, 32.10, 24.69, 23.48, 25.44, 25.99, 25.74, 24.66, 23.22, 23.44, 23.87,
-     22.52, 21.77, 22.46, 23.64, 26.54, 32.18, 31.68, 27.66, 26.81, 27.34, 28.26, 27.80, 27.01, 26.63, 26.86, 27.29,
-     23.71, 22.31, 23.56, 25.88, 27.14, 29.35, 27.11, 27.35, 27.02, 26.89, 28.76, 28.30, 28.11, 28.03, 27.67, 27.69},
-    {20.77, 20.97, 21.25, 21.38, 21.43, 21.63, 21.64, 21.51, 21.62, 21.48, 21.91, 21.52, 21.80, 21.50, 21.26, 21.83,
-     20.94, 21.71, 21.49, 21.64, 21.80, 21.71, 21.65, 21.62, 21.79, 21.78, 21.48, 21.71, 21.71, 21.09, 21.33, 21.91,
-     20.99, 21.41, 21.82, 21.75, 21.81, 21.69, 21.83, 21.69, 21.93, 21.99, 21.55, 21.67, 21.62, 21.73, 21.82, 21.49,
-     21.61, 22.04, 21.86, 22.07, 22.05, 21.89, 21.98, 21.90, 21.97, 21.81, 21.85, 21.92, 21.63, 21.86, 21.90, 21.73,
-     21.85, 22.00, 22.36, 22.24, 22.18, 22.21, 21.92, 22.00, 21.84, 21.84, 21.95, 21.88, 21.97, 21.53, 21.79, 22.17,
-     22.02, 21.80, 22.27, 22.95, 25.88, 25.62, 22.20, 21.97, 21.80, 21.96, 21.80, 21.77, 21.68, 21.45, 21.59, 21.72,
-     22.11, 22.06, 22.70, 24.50, 31.67, 32.36, 27.97, 22.03, 22.00, 21.75, 21.78, 21.76, 21.82, 21.85, 21.64, 21.55,
-     22.07, 22.22, 22.90, 25.04, 30.85, 32.72, 31.38, 23.26, 21.89, 21.71, 21.57, 21.72, 21.83, 21.65, 21.83, 22.06,
-     22.25, 22.06, 22.86, 24.97, 33.07, 33.10, 31.59, 23.54, 21.88, 21.90, 21.84, 21.87, 21.65, 21.75, 21.65, 21.88,
-     21.93, 22.24, 23.00, 24.25, 30.12, 33.22, 31.97, 24.56, 23.65, 25.36, 25.85, 25.59, 24.33, 23.16, 23.00, 23.52,
-     22.77, 22.09, 22.39, 23.39, 26.38, 32.28, 31.50, 27.37, 26.52, 27.00, 28.10, 27.58, 27.01, 26.57, 26.63, 27.46,
-     24.20, 22.21, 23.49, 25.94, 27.38, 29.52, 27.00, 27.04, 26.92, 26.94, 28.93, 28.18, 28.04, 27.96, 27.76, 27.69},
-    {21.02, 20.83, 21.04, 21.06, 21.33, 21.35, 21.49, 21.59, 21.47, 21.67, 21.27, 21.28, 21.40, 20.98, 21.29, 21.22,
-     21.30, 21.01, 21.24, 21.28, 21.37, 21.68, 21.57, 21.69, 21.56, 21.75, 21.39, 21.45, 21.36, 21.32, 21.52, 21.48,
-     21.29, 21.50, 21.40, 21.71, 21.52, 21.61, 21.72, 21.80, 21.72, 21.55, 21.57, 21.43, 21.42, 21.37, 21.62, 21.35,
-     21.24, 21.86, 21.82, 21.83, 21.83, 21.81, 21.82, 21.91, 21.73, 21.82, 21.86, 21.59, 21.81, 21.59, 21.44, 21.52,
-     21.65, 21.70, 21.81, 22.11, 21.88, 21.92, 21.94, 21.86, 21.82, 21.77, 21.97, 21.67, 21.84, 21.32, 21.41, 21.37,
-     21.98, 21.82, 22.06, 22.92, 25.68, 25.84, 22.38, 21.70, 21.82, 21.69, 21.78, 21.57, 21.75, 21.41, 21.62, 21.68,
-     21.62, 21.90, 22.39, 24.43, 31.61, 32.37, 27.98, 22.17, 21.67, 21.68, 21.67, 21.55, 21.59, 21.37, 21.60, 21.74,
-     21.79, 21.92, 22.75, 24.81, 30.53, 32.73, 31.36, 22.99, 21.74, 21.77, 21.67, 21.42, 21.55, 21.73, 21.66, 21.78,
-     22.04, 22.02, 22.70, 24.79, 33.05, 33.20, 31.57, 23.43, 21.65, 21.87, 21.68, 21.55, 21.56, 21.71, 21.54, 21.76,
-     21.70, 22.04, 22.38, 23.93, 30.14, 33.02, 31.99, 24.31, 23.49, 25.33, 25.69, 25.56, 24.35, 23.12, 22.96, 23.30,
-     21.95, 21.64, 22.42, 23.23, 26.07, 32.11, 31.29, 27.40, 26.64, 27.12, 28.28, 27.34, 26.80, 26.53, 26.59, 27.06,
-     22.59, 22.15, 23.12, 25.77, 27.46, 29.38, 27.02, 27.06, 26.73, 26.97, 28.90, 27.98, 27.88, 28.07, 27.37, 27.51},
-    {20.33, 20.74, 20.73, 20.63, 21.39, 21.59, 21.21, 21.20, 21.19, 21.33, 21.21, 21.28, 21.47, 20.83, 21.11, 20.56,
-     20.99, 21.26, 21.17, 21.41, 21.43, 21.74, 21.47, 21.59, 21.51, 21.55, 21.23, 21.16, 21.30, 20.83, 21.12, 21.28,
-     21.46, 21.22, 21.27, 21.37, 21.68, 21.81, 21.67, 21.52, 21.81, 21.46, 21.42, 21.43, 21.70, 21.57, 21.40, 21.44,
-     21.81, 21.65, 21.27, 21.50, 21.78, 22.00, 21.74, 21.61, 21.86, 21.65, 21.50, 21.69, 21.49, 21.65, 21.30, 21.27,
-     21.49, 21.64, 21.75, 21.80, 22.06, 21.88, 21.73, 21.74, 21.98, 21.73, 21.71, 21.71, 21.79, 21.55, 21.01, 21.59,
-     21.83, 21.96, 21.84, 22.57, 25.86, 25.68, 22.06, 21.70, 21.82, 21.85, 21.61, 21.38, 21.40, 21.31, 20.96, 21.53,
-     21.46, 21.83, 22.33, 24.09, 31.57, 32.19, 27.68, 21.85, 21.70, 21.64, 21.54, 21.42, 21.59, 21.60, 21.21, 21.28,
-     21.71, 22.05, 22.29, 24.66, 30.70, 32.54, 31.29, 22.91, 21.66, 21.77, 21.42, 21.28, 21.55, 21.68, 21.46, 21.30,
-     21.88, 21.88, 22.47, 24.69, 32.83, 33.12, 31.45, 23.30, 21.69, 21.70, 21.50, 21.45, 21.67, 21.48, 21.48, 21.44,
-     21.70, 21.90, 22.19, 23.70, 30.05, 33.07, 31.99, 24.31, 23.49, 25.29, 25.55, 25.21, 24.24, 22.75, 22.60, 22.95,
-     21.82, 21.48, 21.93, 22.98, 26.35, 32.11, 31.29, 27.30, 26.45, 27.12, 28.08, 26.97, 26.68, 26.60, 26.51, 26.88,
-     21.85, 21.67, 23.05, 25.43, 27.28, 29.16, 26.80, 27.00, 26.47, 26.86, 28.50, 27.97, 27.81, 27.85, 27.28, 27.04},
-    {21.44, 21.49, 21.00, 21.58, 21.42, 21.67, 21.63, 21.72, 21.55, 21.46, 21.41, 21.37, 21.50, 21.33, 21.60, 21.38,
-     20.93, 21.21, 21.83, 21.69, 21.79, 21.70, 21.85, 21.91, 21.73, 21.41, 21.58, 21.70, 21.32, 21.64, 21.31, 21.71,
-     21.24, 21.75, 21.42, 21.85, 21.70, 21.82, 21.73, 21.95, 21.78, 21.65, 21.73, 21.71, 21.61, 21.59, 21.95, 21.47,
-     21.52, 21.88, 21.91, 22.01, 22.04, 22.10, 21.79, 21.84, 21.70, 21.88, 21.83, 21.66, 21.62, 21.61, 21.60, 21.88,
-     21.76, 21.92, 22.12, 22.17, 22.08, 22.06, 22.00, 21.95, 21.87, 21.82, 21.72, 21.78, 21.91, 21.86, 21.71, 22.24,
-     21.78, 22.04, 22.25, 22.89, 25.79, 25.69, 22.31, 22.03, 21.91, 21.86, 21.79, 21.90, 21.82, 21.71, 21.90, 22.01,
-     21.57, 22.05, 22.63, 24.49, 31.87, 32.31, 28.07, 22.10, 21.76, 21.78, 21.72, 21.61, 21.61, 21.73, 21.95, 21.85,
-     21.59, 22.27, 22.83, 25.03, 30.80, 32.71, 31.45, 23.17, 21.75, 21.78, 21.77, 21.66, 21.72, 22.10, 21.82, 22.05,
-     21.84, 21.98, 22.96, 24.86, 32.85, 33.01, 31.62, 23.52, 21.74, 21.84, 21.83, 21.85, 21.69, 21.62, 21.71, 22.18,
-     22.00, 22.51, 22.92, 23.95, 30.21, 33.08, 32.13, 24.55, 23.51, 25.56, 25.89, 25.73, 24.48, 23.08, 23.21, 23.85,
-     22.26, 22.24, 22.59, 23.31, 26.59, 32.17, 31.72, 27.74, 26.56, 27.28, 28.29, 27.42, 26.94, 26.75, 27.08, 27.19,
-     23.46, 22.49, 23.94, 26.06, 27.37, 29.34, 27.10, 27.24, 26.70, 26.93, 28.81, 28.06, 27.97, 28.02, 27.66, 27.09},
-    {21.27, 21.23, 21.55, 21.37, 21.41, 21.62, 21.52, 21.44, 21.44, 21.41, 21.30, 21.37, 21.50, 21.49, 21.52, 20.83,
-     21.34, 21.46, 21.48, 21.63, 21.73, 21.70, 21.90, 21.76, 21.63, 21.77, 21.63, 21.76, 21.45, 21.29, 21.64, 21.61,
-     21.49, 21.25, 21.55, 21.68, 21.75, 21.87, 21.69, 21.81, 21.83, 21.66, 21.63, 21.71, 21.84, 21.40, 21.65, 21.48,
-     21.35, 21.82, 21.97, 21.84, 21.94, 21.74, 21.84, 21.76, 21.87, 21.71, 21.70, 21.81, 21.72, 21.61, 21.68, 21.55,
-     21.68, 21.86, 22.00, 22.22, 21.89, 22.11, 22.04, 21.75, 21.67, 21.86, 21.85, 21.49, 21.51, 21.51, 21.64, 21.78,
-     21.86, 22.11, 22.31, 22.94, 25.92, 25.44, 21.99, 21.84, 21.99, 21.79, 21.84, 21.62, 21.47, 21.66, 21.58, 21.48,
-     21.72, 22.18, 22.46, 24.44, 31.83, 32.35, 27.99, 22.02, 21.83, 21.74, 21.47, 21.84, 21.56, 21.95, 21.62, 21.77,
-     22.13, 22.21, 22.95, 24.68, 30.71, 33.02, 31.49, 23.21, 21.75, 21.78, 21.73, 21.76, 21.72, 21.58, 21.89, 21.65,
-     21.59, 22.25, 22.67, 24.76, 33.11, 33.09, 31.54, 23.61, 21.91, 21.72, 21.83, 21.56, 21.69, 21.74, 21.85, 21.63,
-     21.64, 21.93, 22.60, 24.18, 30.59, 33.25, 31.96, 24.46, 23.29, 25.48, 25.57, 25.47, 24.37, 23.02, 22.63, 23.16,
-     22.13, 21.84, 22.10, 23.50, 26.48, 32.17, 31.53, 27.74, 26.47, 27.14, 28.14, 27.36, 26.88, 26.49, 26.92, 27.10,
-     22.46, 22.49, 23.62, 25.86, 27.79, 29.45, 27.10, 27.13, 26.64, 27.20, 28.86, 28.11, 28.10, 27.88, 27.66, 26.97},
-    {21.36, 21.54, 21.20, 21.48, 21.58, 21.59, 21.66, 21.93, 21.75, 21.61, 21.75, 21.68, 21.26, 21.37, 21.47, 21.88,
-     22.01, 21.42, 21.87, 21.67, 21.66, 21.63, 21.78, 21.64, 21.96, 21.65, 21.83, 21.62, 21.68, 21.61, 21.44, 22.05,
-     21.63, 21.72, 21.72, 21.71, 21.88, 21.80, 21.90, 21.84, 21.99, 22.05, 21.71, 21.95, 21.93, 21.56, 21.47, 21.78,
-     21.48, 22.06, 21.95, 21.93, 22.12, 21.90, 21.82, 22.08, 21.86, 21.87, 21.77, 21.89, 21.76, 21.77, 21.85, 21.85,
-     21.88, 22.09, 21.98, 22.41, 22.34, 22.18, 22.02, 21.94, 21.90, 21.93, 22.06, 21.95, 22.15, 21.95, 21.61, 22.28,
-     22.21, 21.95, 22.29, 23.07, 25.90, 25.76, 22.46, 22.02, 22.02, 21.93, 21.82, 22.07, 22.10, 21.69, 21.88, 21.75,
-     22.14, 22.15, 22.84, 24.72, 31.90, 32.45, 28.09, 22.21, 21.98, 21.76, 22.13, 21.78, 21.64, 21.76, 21.73, 21.81,
-     21.95, 22.18, 22.87, 24.96, 30.95, 33.01, 31.66, 23.03, 21.82, 21.89, 21.80, 21.97, 21.90, 21.73, 21.92, 22.09,
-     22.12, 22.08, 23.00, 25.05, 33.09, 33.20, 31.69, 23.68, 21.81, 21.79, 21.77, 21.84, 21.78, 21.83, 21.88, 22.31,
-     22.14, 22.19, 23.28, 24.15, 30.48, 33.32, 32.08, 24.71, 23.41, 25.28, 25.96, 25.81, 24.46, 23.00, 23.18, 23.65,
-     21.69, 22.20, 22.70, 23.66, 26.51, 32.01, 31.80, 28.00, 26.50, 27.07, 28.33, 27.50, 27.16, 26.40, 27.20, 27.51,
-     23.33, 22.34, 23.90, 26.17, 27.22, 29.49, 27.41, 27.16, 26.94, 27.34, 28.84, 28.27, 28.08, 28.49, 27.80, 27.86},
-    {21.19, 21.10, 21.21, 21.27, 21.52, 21.65, 21.32, 21.53, 21.69, 21.73, 21.21, 21.09, 21.54, 21.06, 21.11, 20.78,
-     21.50, 21.67, 21.24, 21.41, 21.83, 22.00, 21.42, 21.54, 21.66, 21.75, 21.61, 21.33, 21.80, 21.33, 20.95, 21.67,
-     21.46, 21.51, 21.40, 21.60, 21.83, 21.95, 21.81, 21.75, 21.90, 21.73, 21.47, 21.59, 21.36, 21.69, 21.55, 21.27,
-     21.40, 22.07, 21.46, 21.61, 21.97, 22.00, 21.69, 22.00, 21.86, 21.87, 21.36, 21.79, 22.02, 21.77, 21.30, 21.76,
-     21.80, 21.70, 21.92, 22.00, 22.15, 22.09, 21.86, 21.74, 21.94, 21.85, 21.75, 21.71, 22.00, 21.66, 21.75, 21.75,
-     21.98, 21.96, 22.18, 22.67, 25.86, 25.60, 22.30, 21.78, 21.82, 22.05, 21.61, 21.84, 21.75, 21.70, 21.42, 21.53,
-     21.76, 22.09, 22.33, 24.43, 31.98, 32.53, 27.87, 22.09, 21.78, 21.85, 21.63, 21.64, 21.59, 21.65, 21.73, 21.51,
-     21.71, 22.44, 22.81, 24.71, 30.82, 32.74, 31.40, 22.99, 21.86, 21.77, 21.50, 21.51, 21.65, 21.73, 21.53, 21.54,
-     21.48, 22.36, 22.41, 24.79, 33.14, 33.04, 31.53, 23.51, 21.81, 21.79, 21.50, 21.74, 21.88, 21.83, 21.54, 21.36,
-     21.87, 22.12, 22.64, 23.93, 30.43, 33.28, 31.87, 24.31, 23.36, 25.15, 25.64, 25.41, 24.41, 22.81, 22.67, 23.13,
-     22.45, 21.88, 22.14, 23.10, 26.57, 32.21, 31.66, 27.44, 26.64, 27.40, 27.98, 27.39, 26.74, 26.53, 26.58, 26.52,
-     22.35, 22.06, 23.67, 25.90, 27.76, 29.49, 26.91, 27.16, 26.83, 27.07, 28.73, 28.09, 27.74, 27.93, 27.28, 27.62},
-    {21.19, 20.83, 21.12, 21.20, 21.46, 21.30, 21.50, 21.59, 21.64, 21.56, 21.39, 21.35, 21.33, 21.46, 21.66, 21.55,
-     20.99, 21.42, 21.31, 21.99, 21.77, 21.53, 21.88, 21.94, 21.76, 21.85, 21.50, 21.68, 21.36, 20.76, 21.20, 21.67,
-     21.21, 21.44, 21.66, 21.49, 21.99, 21.76, 21.72, 21.89, 21.90, 21.69, 21.66, 21.69, 21.65, 21.76, 21.55, 21.35,
-     21.65, 21.58, 21.64, 21.94, 21.78, 21.81, 21.91, 21.96, 21.99, 21.91, 21.73, 21.65, 21.92, 21.89, 21.79, 21.85,
-     21.73, 21.70, 21.98, 22.11, 21.97, 21.96, 22.02, 21.94, 21.98, 21.85, 21.88, 21.81, 21.69, 21.95, 21.82, 21.83,
-     21.83, 21.83, 22.18, 23.02, 25.95, 25.64, 22.30, 21.71, 21.98, 21.74, 21.87, 21.89, 21.85, 21.53, 21.68, 21.75,
-     21.99, 22.03, 22.56, 24.43, 31.98, 32.57, 28.17, 22.05, 21.94, 21.85, 21.88, 21.64, 21.69, 21.65, 21.86, 21.66,
-     21.64, 22.05, 22.70, 24.97, 30.78, 32.85, 31.55, 23.00, 21.78, 21.52, 21.89, 21.51, 21.50, 21.96, 21.93, 22.02,
-     21.81, 22.22, 22.94, 25.05, 33.05, 32.92, 31.73, 23.60, 21.65, 21.87, 21.77, 21.74, 21.62, 21.66, 21.68, 21.76,
-     21.97, 22.20, 22.51, 24.04, 30.34, 33.24, 32.12, 24.32, 23.32, 25.29, 25.64, 25.66, 24.24, 22.69, 22.53, 23.30,
-     21.83, 21.96, 22.64, 23.60, 26.51, 32.02, 31.57, 27.72, 26.69, 27.03, 28.33, 27.50, 26.68, 26.60, 27.05, 26.88,
-     23.10, 22.06, 23.44, 26.04, 27.59, 29.49, 27.24, 27.22, 26.89, 26.97, 28.96, 28.39, 28.08, 28.14, 27.54, 27.86},
-    {21.83, 21.40, 21.24, 20.96, 21.44, 21.53, 21.61, 21.59, 21.64, 21.56, 21.27, 21.33, 21.73, 21.26, 21.23, 21.34,
-     21.72, 21.46, 21.28, 21.72, 21.88, 21.90, 21.84, 21.71, 21.82, 21.71, 21.51, 21.50, 21.60, 21.65, 21.31, 21.30,
-     21.66, 21.48, 21.32, 21.60, 22.10, 21.97, 21.69, 21.91, 21.97, 21.75, 21.82, 21.59, 21.65, 21.81, 21.59, 21.21,
-     22.01, 21.35, 21.75, 22.10, 22.13, 22.02, 21.89, 21.94, 21.93, 21.94, 21.84, 21.90, 21.92, 21.88, 21.62, 21.96,
-     22.07, 21.82, 21.81, 22.22, 22.22, 22.33, 21.97, 22.01, 21.93, 21.88, 21.73, 21.87, 21.96, 22.01, 21.79, 21.48,
-     22.40, 22.39, 22.23, 22.83, 25.97, 26.03, 22.41, 22.05, 21.93, 21.85, 21.89, 21.81, 21.71, 21.59, 21.40, 21.79,
-     21.73, 21.95, 22.39, 24.44, 31.84, 32.55, 28.42, 22.08, 22.05, 21.88, 21.65, 21.71, 21.90, 21.99, 21.71, 21.62,
-     22.06, 22.56, 22.57, 24.67, 30.84, 33.11, 31.69, 23.35, 21.89, 21.92, 21.74, 21.53, 21.91, 21.67, 21.64, 21.34,
-     21.92, 22.41, 22.59, 24.70, 32.94, 33.34, 31.71, 23.58, 21.97, 21.77, 21.97, 21.51, 21.89, 21.83, 21.66, 21.55,
-     22.26, 22.24, 22.76, 24.21, 30.30, 33.34, 31.93, 24.56, 23.52, 25.17, 25.80, 25.52, 24.29, 23.11, 22.57, 23.15,
-     22.21, 22.09, 22.47, 23.41, 26.62, 32.26, 31.72, 27.64, 26.56, 27.23, 28.08, 27.61, 26.79, 26.32, 26.92, 27.17,
-     23.74, 22.28, 23.64, 25.89, 27.46, 29.54, 27.19, 27.27, 26.94, 26.97, 28.84, 28.26, 28.12, 27.89, 27.30, 27.15},
-    {21.14, 20.94, 21.16, 21.31, 21.38, 21.41, 21.72, 21.65, 21.64, 21.61, 21.56, 21.79, 21.23, 21.25, 21.77, 21.45,
-     21.62, 21.45, 21.57, 21.84, 21.88, 21.79, 21.89, 21.86, 21.67, 21.76, 21.50, 21.79, 21.79, 21.23, 21.06, 22.07,
-     21.06, 21.69, 21.83, 21.83, 21.94, 22.01, 21.65, 21.86, 22.10, 21.84, 21.82, 21.70, 21.76, 21.61, 21.81, 21.98,
-     21.84, 21.90, 21.81, 21.88, 21.80, 22.24, 22.06, 22.02, 21.84, 21.81, 21.88, 21.90, 21.92, 21.70, 21.83, 22.04,
-     21.84, 21.82, 22.04, 22.22, 22.50, 22.07, 21.93, 22.13, 21.89, 22.00, 21.95, 21.68, 21.85, 21.83, 21.53, 21.94,
-     22.10, 21.87, 22.12, 22.83, 25.79, 25.99, 22.61, 21.97, 21.93, 22.08, 21.85, 21.90, 21.81, 21.42, 21.86, 21.64,
-     21.66, 21.95, 22.50, 24.44, 31.88, 32.51, 28.50, 22.36, 21.93, 22.00, 21.82, 21.80, 21.55, 21.65, 21.77, 22.16,
-     21.91, 22.10, 22.75, 24.78, 30.63, 32.80, 31.73, 23.35, 21.93, 21.80, 21.83, 21.94, 21.76, 21.61, 22.04, 21.73,
-     22.17, 22.27, 23.17, 25.06, 33.03, 33.06, 31.71, 23.87, 21.76, 21.90, 21.79, 21.90, 21.84, 21.83, 22.00, 22.19,
-     22.09, 22.16, 22.69, 24.10, 30.06, 33.25, 32.22, 24.73, 23.12, 25.13, 25.43, 25.57, 24.24, 22.74, 23.15, 23.24,
-     22.21, 22.08, 22.54, 23.28, 26.35, 32.12, 31.90, 27.78, 26.52, 27.23, 27.94, 27.24, 26.73, 26.64, 26.70, 26.81,
-     23.01, 22.18, 23.56, 26.02, 27.64, 29.38, 27.35, 27.22, 27.00, 27.29, 28.95, 28.26, 28.05, 27.96, 27.48, 27.50},
-    {20.32, 20.83, 21.05, 21.34, 21.52, 21.59, 21.44, 21.59, 21.36, 21.45, 21.64, 21.28, 21.40, 20.75, 21.20, 21.22,
-     21.30, 21.58, 21.17, 21.48, 21.71, 21.58, 21.83, 21.74, 21.71, 21.55, 21.50, 21.74, 21.68, 21.19, 21.03, 21.57,
-     21.63, 21.43, 21.59, 21.77, 21.83, 21.71, 21.76, 21.71, 21.63, 21.87, 21.57, 21.75, 21.48, 21.50, 21.48, 21.79,
-     21.73, 21.58, 21.46, 21.77, 21.68, 21.82, 21.78, 21.79, 21.73, 21.48, 21.64, 21.84, 21.39, 21.53, 21.51, 21.60,
-     21.80, 21.83, 21.87, 21.95, 22.11, 22.01, 21.86, 21.94, 21.90, 21.81, 21.71, 21.90, 21.85, 21.61, 21.88, 21.21,
-     21.90, 21.83, 22.29, 22.87, 25.73, 26.00, 22.42, 21.90, 21.82, 21.85, 21.87, 21.84, 21.70, 21.48, 21.55, 21.68,
-     21.31, 21.90, 22.28, 24.28, 31.90, 32.38, 28.43, 22.09, 21.90, 21.65, 21.67, 21.64, 21.59, 21.54, 21.66, 21.97,
-     21.87, 22.12, 23.04, 24.71, 30.53, 32.93, 31.78, 23.40, 21.86, 21.61, 21.63, 21.65, 21.55, 21.73, 21.86, 21.31,
-     21.88, 22.36, 22.70, 24.74, 32.92, 33.12, 31.77, 23.76, 21.81, 21.96, 21.68, 21.64, 21.88, 21.84, 21.89, 21.28,
-     21.69, 21.97, 22.77, 24.04, 30.29, 33.19, 32.08, 24.58, 23.27, 25.11, 25.55, 25.36, 24.29, 22.69, 23.04, 23.30,
-     21.69, 22.04, 22.70, 23.41, 26.40, 31.97, 31.84, 27.81, 26.40, 27.07, 28.08, 27.34, 26.74, 26.54, 26.58, 27.24,
-     22.82, 22.25, 23.51, 25.90, 27.16, 29.38, 27.30, 27.06, 26.99, 27.13, 29.01, 28.21, 27.81, 27.78, 27.28, 27.39},
-    {21.11, 20.79, 21.17, 21.60, 21.37, 21.63, 21.93, 21.80, 21.68, 21.37, 21.55, 21.59, 21.31, 21.11, 21.71, 21.62,
-     21.25, 21.39, 21.43, 21.52, 21.75, 21.72, 21.71, 21.83, 21.84, 21.48, 21.76, 21.78, 21.53, 21.30, 21.57, 21.92,
-     21.34, 21.55, 21.76, 21.70, 21.82, 21.69, 21.75, 21.78, 21.58, 21.67, 21.55, 21.73, 21.63, 21.54, 21.89, 21.84,
-     21.45, 21.49, 21.80, 22.08, 21.96, 21.80, 21.81, 21.94, 21.68, 21.73, 21.90, 21.97, 21.74, 21.51, 21.90, 21.32,
-     21.54, 21.68, 22.08, 22.34, 22.28, 21.91, 21.85, 22.01, 21.97, 21.84, 21.87, 21.79, 21.73, 21.76, 21.72, 21.95,
-     21.57, 21.93, 22.16, 22.86, 25.67, 25.99, 22.33, 21.89, 22.01, 21.72, 21.90, 21.87, 22.04, 21.62, 21.72, 21.88,
-     21.59, 22.07, 22.43, 24.31, 31.68, 32.29, 28.53, 22.20, 21.73, 21.67, 21.70, 21.72, 21.82, 21.69, 21.83, 21.94,
-     21.99, 21.90, 22.44, 24.85, 30.68, 32.80, 31.65, 23.47, 21.81, 21.51, 21.71, 21.68, 21.84, 21.65, 21.97, 21.91,
-     22.01, 21.99, 22.74, 24.88, 32.78, 33.10, 31.79, 23.91, 21.80, 21.61, 21.94, 21.73, 21.76, 21.58, 21.93, 22.12,
-     21.84, 21.94, 22.55, 23.91, 30.03, 33.13, 32.27, 24.66, 23.17, 24.92, 25.58, 25.29, 23.66, 22.60, 22.65, 23.61,
-     21.89, 21.61, 22.47, 23.27, 26.16, 32.09, 31.83, 27.89, 26.44, 26.91, 28.26, 27.54, 26.48, 26.18, 26.94, 26.94,
-     22.72, 22.21, 23.64, 25.48, 27.02, 29.30, 27.61, 27.20, 26.82, 26.68, 28.99, 28.13, 27.92, 27.54, 27.42, 27.58},
-    {21.46, 21.33, 21.18, 21.53, 21.43, 21.28, 21.53, 21.29, 21.51, 21.48, 21.31, 21.33, 21.30, 21.19, 21.53, 21.51,
-     21.46, 21.47, 21.64, 21.52, 21.47, 21.88, 21.81, 21.73, 21.74, 21.68, 21.65, 21.37, 21.53, 21.23, 20.92, 21.72,
-     21.51, 21.48, 21.69, 21.64, 21.71, 21.84, 21.57, 21.78, 21.93, 21.72, 21.65, 21.52, 21.63, 21.61, 21.22, 21.06,
-     21.86, 21.56, 21.68, 21.97, 21.72, 21.71, 21.81, 21.65, 21.72, 21.77, 21.81, 21.73, 21.58, 21.57, 21.55, 21.49,
-     21.54, 21.74, 21.96, 22.09, 22.05, 21.91, 21.76, 21.81, 21.77, 21.80, 21.65, 21.70, 21.78, 21.70, 21.59, 21.56,
-     21.65, 22.00, 22.27, 22.71, 25.23, 25.95, 22.25, 21.89, 21.65, 21.77, 21.81, 21.64, 21.49, 21.46, 21.46, 21.50,
-     21.96, 22.13, 22.31, 24.17, 31.60, 32.36, 28.61, 22.08, 21.81, 21.76, 21.87, 21.76, 21.72, 22.02, 21.58, 21.79,
-     21.99, 22.09, 22.50, 24.50, 30.56, 32.80, 31.58, 23.47, 21.89, 21.52, 21.66, 21.64, 21.69, 21.66, 21.84, 21.59,
-     21.61, 22.26, 22.39, 24.62, 32.82, 33.11, 31.71, 23.87, 21.80, 21.61, 21.76, 21.68, 21.65, 21.58, 21.79, 21.73,
-     21.92, 22.09, 22.30, 23.74, 29.83, 33.27, 32.15, 24.39, 23.26, 25.18, 25.40, 25.24, 24.16, 22.79, 22.43, 22.84,
-     22.51, 21.85, 22.60, 23.21, 26.11, 32.05, 31.97, 27.89, 26.44, 27.06, 27.86, 27.38, 26.66, 26.51, 26.63, 26.84,
-     22.71, 22.01, 23.48, 25.41, 27.20, 29.41, 27.22, 26.99, 26.76, 27.06, 28.77, 28.19, 27.72, 27.54, 26.82, 27.22},
-    {21.87, 20.83, 21.28, 21.20, 21.52, 21.53, 21.32, 21.59, 21.42, 21.90, 21.33, 21.42, 21.47, 21.14, 21.29, 21.66,
-     21.60, 21.34, 21.24, 21.54, 21.72, 22.00, 21.73, 21.79, 21.76, 21.80, 21.45, 21.74, 21.49, 21.26, 21.11, 21.86,
-     21.46, 21.50, 21.72, 21.94, 21.83, 21.66, 21.94, 21.93, 21.90, 21.69, 21.81, 21.75, 21.76, 21.37, 21.40, 21.44,
-     21.57, 21.51, 21.58, 21.83, 22.12, 21.68, 21.82, 21.96, 21.73, 21.78, 21.64, 21.79, 22.02, 21.71, 21.51, 21.68,
-     21.73, 21.77, 21.75, 22.06, 22.25, 21.92, 21.90, 21.74, 21.98, 21.64, 21.80, 21.86, 21.74, 21.78, 21.68, 21.83,
-     22.06, 21.69, 22.29, 22.97, 25.42, 26.12, 22.38, 21.86, 21.98, 21.93, 21.91, 21.79, 21.70, 21.64, 21.49, 21.60,
-     22.06, 22.34, 22.39, 23.89, 31.73, 32.56, 28.58, 22.05, 21.78, 21.80, 21.75, 21.64, 21.93, 21.65, 21.40, 21.74,
-     22.10, 22.38, 22.64, 24.91, 30.87, 32.73, 31.78, 23.48, 21.86, 21.69, 21.55, 21.74, 21.85, 21.62, 22.06, 21.78,
-     22.04, 22.22, 22.76, 24.69, 32.79, 33.24, 31.65, 23.96, 21.81, 22.00, 21.86, 21.84, 21.57, 21.89, 21.95, 21.99,
-     22.49, 22.19, 22.64, 23.70, 30.00, 33.02, 32.37, 24.62, 23.23, 25.11, 25.50, 25.56, 24.30, 22.94, 22.53, 23.30,
-     22.44, 22.12, 22.70, 23.23, 26.40, 32.11, 31.75, 27.72, 26.45, 27.21, 27.98, 27.45, 26.98, 26.27, 26.66, 27.15,
-     24.29, 22.54, 23.82, 25.84, 27.58, 29.81, 27.13, 27.32, 26.99, 27.23, 28.73, 28.04, 28.08, 27.71, 27.63, 27.28},
-    {21.31, 21.57, 21.48, 21.31, 21.69, 21.53, 21.72, 21.59, 21.69, 21.73, 21.33, 21.66, 21.51, 21.34, 21.41, 21.23,
-     21.72, 21.62, 21.42, 21.27, 21.88, 21.79, 21.78, 21.66, 21.97, 21.86, 21.83, 21.68, 21.98, 21.37, 21.80, 21.78,
-     21.49, 21.91, 21.64, 21.77, 21.84, 21.92, 21.92, 21.86, 21.88, 21.93, 21.73, 21.44, 21.82, 21.81, 21.74, 21.81,
-     21.68, 22.04, 21.57, 22.15, 21.99, 22.02, 22.07, 21.94, 22.06, 22.07, 21.66, 21.95, 21.71, 21.94, 21.62, 22.12,
-     22.07, 22.08, 21.92, 22.32, 22.36, 22.03, 22.01, 22.09, 22.05, 22.13, 21.86, 21.92, 21.90, 22.01, 21.73, 21.55,
-     22.17, 21.94, 22.46, 23.03, 25.88, 26.31, 22.53, 21.93, 22.08, 21.85, 21.63, 21.86, 21.76, 21.81, 21.73, 21.94,
-     21.73, 22.33, 22.22, 24.20, 31.75, 32.67, 28.68, 22.12, 21.86, 21.84, 21.82, 21.84, 21.95, 21.88, 21.65, 21.85,
-     22.14, 22.36, 22.92, 24.67, 30.54, 32.95, 31.73, 23.51, 22.05, 21.84, 21.79, 21.67, 21.81, 21.96, 22.17, 21.73,
-     21.76, 22.40, 22.64, 24.69, 32.94, 33.14, 31.79, 23.87, 22.05, 21.98, 21.88, 21.66, 21.94, 21.77, 21.45, 21.63,
-     22.25, 22.38, 22.95, 23.76, 29.86, 33.34, 32.14, 24.73, 23.30, 25.26, 25.52, 25.32, 24.12, 22.99, 22.49, 22.72,
-     22.07, 22.40, 22.61, 23.59, 26.07, 32.21, 31.90, 28.01, 26.42, 27.32, 28.08, 27.50, 26.85, 26.77, 26.77, 26.90,
-     22.97, 22.37, 23.24, 25.68, 27.51, 29.76, 27.57, 27.06, 26.79, 27.13, 29.00, 28.14, 28.11, 27.75, 27.56, 27.61},
-    {21.42, 21.63, 20.98, 21.37, 21.62, 21.51, 21.76, 21.69, 21.63, 21.77, 21.55, 21.51, 21.43, 21.78, 21.29, 21.41,
-     21.58, 21.27, 21.62, 21.70, 21.82, 21.78, 21.52, 21.90, 21.81, 21.70, 21.77, 21.78, 21.84, 21.42, 21.20, 21.66,
-     21.90, 21.67, 21.62, 21.70, 21.94, 22.10, 21.78, 22.04, 21.92, 21.97, 21.82, 21.85, 21.92, 21.85, 21.57, 21.96,
-     22.06, 21.47, 21.86, 21.87, 22.17, 22.01, 22.10, 21.85, 21.88, 21.85, 21.83, 21.65, 21.86, 21.75, 21.81, 22.02,
-     21.51, 22.06, 21.91, 22.11, 22.12, 22.33, 21.92, 21.97, 21.89, 21.96, 22.03, 21.91, 22.05, 21.76, 21.78, 22.07,
-     22.07, 21.99, 22.11, 22.93, 25.57, 26.18, 22.49, 22.01, 22.01, 21.80, 21.84, 21.81, 21.96, 21.41, 21.78, 21.54,
-     21.64, 22.12, 22.43, 23.95, 31.55, 32.70, 28.83, 22.28, 21.81, 21.87, 21.90, 21.75, 21.65, 21.53, 21.82, 21.98,
-     21.96, 22.15, 22.91, 24.67, 30.54, 32.95, 31.88, 23.59, 21.85, 21.84, 21.78, 21.94, 21.80, 21.83, 21.69, 21.79,
-     22.06, 22.18, 23.04, 24.64, 32.76, 33.25, 31.94, 24.19, 21.92, 21.94, 21.97, 21.70, 21.77, 21.46, 22.05, 22.16,
-     22.06, 22.14, 22.80, 23.97, 29.66, 33.20, 32.26, 24.68, 23.25, 24.77, 25.33, 25.26, 24.00, 22.79, 23.06, 23.65,
-     21.65, 21.74, 22.52, 23.58, 26.12, 32.02, 31.80, 28.29, 26.70, 27.17, 28.03, 27.65, 26.78, 26.23, 26.98, 26.96,
-     21.40, 21.65, 23.53, 25.73, 27.62, 29.58, 27.51, 27.21, 26.89, 27.28, 28.77, 28.07, 27.84, 27.87, 27.79, 27.46},
-    {21.13, 20.81, 21.19, 21.25, 21.19, 21.35, 21.66, 21.69, 21.35, 21.61, 21.38, 21.27, 21.10, 20.97, 21.36, 21.41,
-     21.06, 21.40, 21.44, 21.59, 21.59, 21.57, 21.67, 21.49, 21.40, 21.39, 21.44, 21.27, 21.47, 20.89, 21.09, 21.25,
-     21.61, 21.20, 21.64, 21.76, 21.67, 21.70, 21.94, 21.79, 21.58, 21.64, 21.61, 21.58, 21.75, 21.17, 21.46, 21.85,
-     21.55, 21.29, 21.63, 21.82, 21.87, 21.90, 22.00, 21.74, 21.81, 21.78, 21.72, 21.84, 21.65, 21.46, 21.56, 21.83,
-     21.39, 21.62, 21.63, 22.20, 22.29, 21.96, 21.77, 22.02, 21.90, 21.77, 21.75, 21.61, 21.74, 21.48, 21.47, 21.50,
-     21.96, 22.01, 22.17, 22.62, 25.41, 26.81, 22.74, 21.94, 21.86, 21.85, 21.82, 21.56, 21.64, 21.63, 21.14, 21.66,
-     21.75, 21.63, 22.32, 23.64, 30.75, 32.22, 29.50, 22.05, 21.55, 21.68, 21.75, 21.77, 21.63, 21.31, 21.65, 21.80,
-     21.69, 21.71, 22.33, 24.06, 29.97, 32.58, 31.89, 23.80, 21.78, 21.69, 21.67, 21.51, 21.64, 21.61, 21.71, 21.36,
-     21.62, 21.67, 22.40, 24.11, 31.92, 33.15, 31.84, 24.04, 21.93, 21.62, 21.72, 21.69, 21.66, 21.47, 21.53, 21.66,
-     21.50, 21.96, 22.31, 23.47, 28.68, 33.02, 32.28, 24.40, 23.05, 24.62, 24.90, 24.65, 23.50, 22.06, 22.36, 22.84,
-     21.91, 21.94, 22.27, 23.22, 25.85, 31.96, 31.88, 27.76, 26.26, 26.88, 27.87, 27.33, 26.49, 26.26, 26.49, 26.94,
-     22.25, 21.54, 23.19, 25.55, 27.09, 29.37, 27.18, 26.89, 26.83, 26.85, 29.06, 27.96, 27.80, 27.77, 27.69, 27.00},
-    {21.36, 21.10, 20.89, 21.13, 21.40, 21.42, 21.33, 21.60, 21.76, 21.56, 21.46, 21.29, 21.26, 21.22, 21.66, 24.36,
-     21.91, 21.26, 21.53, 21.48, 21.89, 21.74, 21.63, 21.65, 21.86, 21.70, 21.83, 21.34, 21.56, 21.33, 21.53, 23.48,
-     21.72, 21.36, 21.46, 21.61, 21.53, 22.00, 21.95, 21.89, 21.86, 21.78, 21.57, 21.64, 21.54, 21.76, 21.18, 22.30,
-     21.49, 21.65, 21.52, 21.72, 21.98, 22.05, 21.78, 21.96, 21.95, 21.96, 21.69, 21.70, 21.82, 21.71, 21.79, 21.85,
-     21.73, 21.64, 21.93, 22.21, 22.25, 22.14, 22.15, 21.95, 21.78, 21.94, 21.76, 21.63, 21.85, 21.67, 21.55, 21.98,
-     21.98, 21.96, 22.01, 22.58, 24.76, 28.02, 23.82, 21.95, 21.94, 21.74, 21.70, 21.75, 21.76, 21.53, 21.62, 21.76,
-     21.47, 22.03, 22.11, 23.16, 29.76, 32.19, 30.86, 22.60, 21.83, 21.85, 21.84, 21.74, 21.69, 21.60, 21.60, 21.51,
-     21.87, 22.12, 22.46, 23.62, 30.11, 31.92, 32.31, 24.69, 21.87, 21.81, 21.77, 21.75, 21.81, 21.79, 21.66, 21.63,
-     22.13, 22.16, 22.29, 23.24, 30.52, 33.60, 32.40, 24.94, 21.90, 21.75, 21.73, 21.75, 21.73, 21.72, 21.62, 21.60,
-     22.05, 21.75, 22.19, 23.25, 27.11, 32.63, 32.67, 25.03, 22.97, 24.54, 25.00, 23.70, 22.38, 21.82, 22.02, 21.66,
-     21.69, 21.96, 22.43, 22.67, 25.42, 31.83, 31.71, 28.10, 26.37, 27.32, 28.28, 27.19, 26.63, 25.42, 25.44, 25.27,
-     22.09, 21.76, 22.97, 25.44, 27.17, 29.49, 27.47, 26.96, 26.89, 27.08, 28.79, 28.04, 27.82, 28.00, 26.94, 26.46},
-    {21.53, 20.65, 21.52, 21.41, 21.39, 21.42, 21.50, 21.54, 21.64, 21.51, 21.70, 21.55, 21.05, 21.23, 21.02, 21.88,
-     21.81, 21.51, 21.39, 21.67, 21.49, 21.58, 21.37, 21.80, 21.76, 21.81, 21.78, 21.63, 21.36, 21.19, 21.37, 21.77,
-     21.38, 21.44, 21.46, 21.83, 21.79, 21.81, 21.59, 21.80, 21.91, 21.69, 21.86, 21.54, 21.60, 21.70, 21.55, 21.79,
-     21.49, 21.79, 21.71, 21.83, 21.73, 21.73, 22.05, 21.92, 21.82, 21.79, 21.87, 21.85, 21.66, 21.60, 21.72, 22.10,
-     21.80, 21.57, 22.04, 21.86, 22.25, 22.27, 21.86, 21.98, 21.78, 21.98, 22.06, 21.81, 21.70, 21.78, 21.69, 21.98,
-     22.06, 21.90, 22.07, 22.43, 24.13, 28.85, 25.67, 21.99, 21.82, 21.86, 21.79, 21.75, 21.56, 21.65, 21.62, 21.53,
-     21.91, 21.58, 22.28, 22.96, 28.17, 31.89, 32.09, 23.92, 21.71, 21.81, 21.76, 21.83, 21.64, 21.60, 21.67, 21.59,
-     21.48, 21.79, 22.52, 23.06, 29.03, 30.85, 32.64, 26.51, 21.79, 21.78, 21.68, 21.56, 21.45, 21.68, 22.00, 21.70,
-     21.64, 21.95, 22.41, 23.03, 28.79, 33.36, 33.10, 26.31, 21.86, 21.75, 21.82, 21.70, 21.52, 21.60, 21.82, 21.84,
-     21.61, 21.68, 22.52, 23.08, 25.76, 32.55, 32.80, 26.43, 22.97, 24.27, 24.58, 23.09, 21.87, 21.82, 21.87, 21.92,
-     22.32, 21.72, 22.14, 22.80, 24.98, 31.21, 32.18, 28.75, 25.94, 27.32, 27.63, 26.76, 25.54, 23.41, 22.61, 23.24,
-     23.07, 21.86, 23.59, 25.43, 26.98, 29.44, 27.90, 26.58, 26.89, 27.08, 28.34, 28.04, 27.22, 26.93, 26.43, 25.63},
-    {21.10, 21.23, 21.16, 21.66, 21.68, 21.56, 21.41, 21.68, 21.78, 21.47, 21.48, 21.45, 21.44, 21.49, 20.88, 21.71,
-     21.86, 21.38, 21.63, 21.57, 21.74, 21.60, 21.55, 21.82, 21.93, 21.67, 21.75, 21.60, 21.58, 21.50, 21.32, 21.91,
-     21.85, 21.97, 21.75, 21.80, 22.01, 22.02, 21.96, 22.05, 21.79, 21.93, 21.78, 21.82, 21.79, 21.53, 21.58, 21.74,
-     21.69, 22.03, 21.79, 22.13, 22.24, 22.15, 22.02, 21.81, 21.88, 21.98, 21.61, 21.82, 22.05, 21.74, 22.03, 21.72,
-     22.23, 22.06, 22.07, 22.03, 22.32, 22.54, 22.29, 22.08, 21.88, 21.99, 21.86, 21.74, 21.97, 21.98, 21.38, 22.02,
-     21.87, 22.24, 22.15, 22.45, 23.66, 28.94, 27.69, 22.28, 22.00, 21.99, 21.97, 21.86, 21.98, 21.66, 21.52, 21.79,
-     21.88, 21.86, 22.08, 22.74, 26.57, 31.78, 32.32, 26.37, 22.00, 21.82, 21.94, 21.80, 21.86, 21.51, 21.82, 22.08,
-     22.06, 22.08, 22.26, 22.83, 27.35, 30.79, 32.66, 28.88, 22.04, 21.91, 21.82, 21.81, 21.98, 21.99, 21.76, 22.13,
-     21.92, 21.98, 22.26, 22.84, 27.08, 33.30, 33.30, 28.50, 22.12, 22.10, 21.75, 21.57, 21.91, 21.86, 21.99, 22.03,
-     21.92, 22.08, 22.15, 22.47, 24.61, 31.82, 32.98, 27.96, 22.90, 24.06, 23.95, 22.45, 22.18, 22.16, 21.76, 22.57,
-     21.63, 22.24, 21.76, 22.95, 24.56, 30.89, 32.52, 29.46, 25.91, 27.62, 27.15, 26.56, 24.72, 22.42, 21.93, 23.57,
-     22.22, 22.59, 23.08, 25.53, 26.71, 29.57, 28.57, 26.29, 27.33, 27.05, 27.33, 28.30, 27.65, 25.94, 24.28, 24.49},
-    {20.81, 21.03, 21.37, 21.05, 21.31, 21.45, 21.53, 21.68, 21.55, 21.53, 21.31, 21.34, 21.18, 21.15, 21.23, 21.27,
-     21.44, 21.59, 21.59, 21.65, 21.46, 21.65, 21.85, 21.66, 21.47, 21.77, 21.75, 21.77, 21.41, 21.32, 21.37, 21.50,
-     21.39, 21.58, 21.77, 21.86, 21.95, 21.91, 21.81, 21.75, 21.86, 21.64, 21.53, 21.35, 21.51, 21.36, 21.77, 21.63,
-     21.49, 21.51, 21.93, 21.85, 21.84, 21.77, 21.82, 21.87, 21.86, 21.78, 21.51, 21.76, 21.62, 21.33, 21.85, 22.60,
-     21.65, 21.95, 21.84, 21.92, 22.02, 22.31, 22.14, 22.17, 21.77, 21.85, 21.97, 21.67, 21.81, 21.41, 21.67, 23.34,
-     21.83, 21.75, 21.76, 22.49, 22.78, 27.97, 28.76, 22.64, 21.65, 21.80, 21.82, 21.89, 21.51, 21.56, 21.73, 24.01,
-     21.69, 21.69, 21.80, 22.33, 25.08, 31.76, 32.32, 28.21, 21.85, 21.59, 21.75, 21.64, 21.50, 21.57, 21.91, 25.26,
-     21.64, 21.78, 21.97, 22.61, 25.96, 30.80, 32.03, 30.61, 21.93, 21.76, 21.59, 21.70, 21.82, 21.59, 22.05, 24.96,
-     21.48, 21.53, 21.73, 22.62, 25.60, 32.80, 33.28, 29.95, 22.09, 21.78, 21.50, 21.46, 21.59, 21.64, 21.74, 24.51,
-     21.98, 21.60, 22.04, 22.65, 23.84, 31.28, 32.92, 29.30, 22.52, 23.32, 23.18, 22.34, 21.72, 21.68, 21.35, 24.43,
-     21.89, 21.56, 21.85, 22.46, 24.23, 29.77, 32.55, 29.90, 25.71, 26.80, 27.00, 26.40, 23.75, 22.17, 21.98, 24.92,
-     22.33, 21.99, 22.97, 25.22, 26.78, 29.52, 28.79, 26.28, 26.75, 26.94, 27.40, 28.07, 27.14, 25.10, 23.64, 24.38},
-    {20.22, 20.90, 20.62, 21.03, 21.29, 21.43, 21.22, 21.55, 21.32, 21.29, 21.11, 21.05, 21.16, 21.19, 20.73, 21.89,
-     21.40, 21.24, 21.14, 21.44, 21.50, 21.42, 21.42, 21.54, 21.61, 21.50, 21.24, 21.18, 21.58, 21.44, 21.99, 23.18,
-     21.36, 21.33, 21.49, 21.56, 21.89, 21.66, 21.62, 21.56, 21.85, 21.68, 21.56, 21.17, 21.43, 21.33, 22.56, 24.15,
-     21.63, 21.55, 21.36, 21.62, 21.68, 21.85, 21.64, 21.56, 21.85, 21.64, 21.49, 21.54, 22.08, 22.03, 23.13, 24.99,
-     21.55, 21.27, 21.36, 21.70, 22.01, 22.21, 22.01, 21.80, 21.80, 21.96, 21.44, 21.33, 22.25, 23.05, 24.28, 26.07,
-     21.35, 21.66, 21.45, 21.77, 22.91, 27.24, 28.49, 22.47, 21.99, 21.67, 21.55, 21.47, 21.75, 23.29, 25.62, 27.20,
-     21.44, 21.60, 21.72, 22.17, 24.54, 31.78, 32.10, 28.31, 21.72, 21.86, 21.40, 21.36, 21.74, 23.80, 26.50, 27.78,
-     21.77, 21.49, 21.95, 22.39, 25.37, 30.83, 31.80, 30.56, 22.04, 21.67, 21.53, 21.50, 21.60, 23.18, 26.29, 27.72,
-     21.70, 21.64, 21.83, 22.18, 25.26, 32.67, 33.19, 30.02, 22.12, 21.77, 21.54, 21.50, 21.62, 21.85, 25.02, 27.90,
-     21.60, 21.58, 21.50, 22.29, 23.52, 30.64, 32.74, 29.16, 22.56, 23.13, 23.07, 22.02, 21.48, 21.78, 23.59, 27.68,
-     21.84, 21.53, 21.76, 22.00, 23.93, 29.27, 32.17, 29.61, 25.79, 27.02, 26.68, 26.17, 23.73, 22.08, 22.51, 25.62,
-     21.49, 21.85, 22.16, 24.73, 26.46, 29.66, 28.61, 26.00, 26.69, 26.87, 27.09, 27.88, 27.05, 25.15, 23.96, 25.41},
-    {20.86, 21.20, 21.14, 21.07, 21.53, 21.19, 21.56, 21.66, 21.70, 21.28, 21.28, 21.29, 21.70, 21.78, 21.67, 22.22,
-     21.31, 21.35, 21.11, 21.55, 21.95, 21.75, 21.38, 21.41, 21.62, 21.71, 21.46, 22.27, 22.63, 24.06, 23.87, 23.39,
-     21.30, 21.52, 21.21, 21.50, 21.69, 21.86, 21.73, 21.63, 21.69, 21.65, 21.53, 22.23, 23.51, 25.17, 26.02, 25.01,
-     21.82, 21.73, 21.34, 21.62, 21.98, 22.14, 21.83, 21.67, 21.83, 21.71, 21.65, 22.29, 23.97, 25.75, 26.33, 26.60,
-     21.58, 21.65, 21.70, 21.71, 22.07, 22.02, 22.08, 21.87, 21.87, 22.11, 22.45, 23.35, 25.04, 26.51, 27.76, 27.12,
-     21.61, 21.58, 21.68, 22.03, 22.83, 26.94, 27.64, 22.35, 21.87, 21.86, 22.43, 24.37, 26.20, 27.41, 28.40, 27.59,
-     21.92, 21.78, 22.00, 22.28, 25.00, 31.77, 32.17, 27.52, 21.91, 21.90, 21.93, 24.01, 26.97, 28.53, 28.63, 27.74,
-     21.80, 21.74, 21.94, 22.20, 25.92, 31.05, 32.09, 30.28, 22.11, 21.70, 21.60, 22.75, 25.74, 28.29, 28.60, 28.12,
-     21.49, 21.63, 21.83, 22.51, 25.41, 32.85, 33.33, 29.62, 22.15, 21.88, 21.60, 21.70, 23.83, 27.29, 29.03, 28.38,
-     21.53, 21.62, 21.49, 22.11, 23.88, 30.75, 32.72, 28.58, 22.49, 23.24, 23.14, 21.92, 21.93, 24.79, 28.22, 28.03,
-     21.71, 21.33, 21.74, 22.18, 23.93, 28.99, 32.36, 29.67, 25.71, 27.22, 26.94, 26.44, 24.33, 23.08, 25.83, 26.89,
-     22.62, 21.39, 22.12, 24.91, 26.57, 29.17, 28.83, 26.16, 26.74, 26.87, 27.54, 27.81, 27.02, 26.21, 26.17, 27.17},
-    {21.55, 21.02, 21.13, 21.21, 21.47, 21.48, 21.67, 21.55, 21.71, 21.97, 22.24, 22.66, 22.75, 22.25, 22.49, 22.22,
-     21.41, 21.67, 21.39, 21.42, 21.61, 21.80, 21.79, 21.90, 22.07, 22.87, 24.03, 24.71, 24.62, 23.92, 22.99, 22.92,
-     21.56, 21.73, 21.73, 21.67, 21.58, 21.86, 21.73, 21.99, 22.68, 23.50, 24.84, 25.92, 26.35, 25.23, 23.85, 23.33,
-     21.58, 21.73, 21.96, 22.00, 22.08, 21.96, 21.92, 22.18, 22.59, 23.80, 25.26, 26.99, 27.34, 26.32, 24.39, 23.33,
-     21.89, 21.84, 21.70, 21.91, 22.26, 22.27, 22.12, 22.19, 22.07, 23.67, 25.42, 27.69, 28.08, 26.57, 24.51, 23.13,
-     21.76, 21.90, 21.68, 22.08, 22.83, 26.82, 26.21, 22.23, 23.23, 24.85, 26.67, 28.21, 28.90, 27.30, 24.97, 23.34,
-     22.00, 21.78, 21.78, 22.48, 25.22, 31.92, 32.34, 26.06, 23.15, 24.66, 27.54, 28.87, 28.92, 27.96, 25.61, 24.08,
-     21.81, 21.47, 22.06, 22.56, 26.32, 31.13, 32.38, 29.07, 22.24, 24.19, 26.56, 28.48, 29.20, 28.83, 26.53, 24.12,
-     21.98, 21.56, 22.13, 22.51, 26.20, 33.17, 33.33, 28.96, 22.27, 22.55, 24.35, 27.01, 29.22, 29.55, 27.94, 25.43,
-     21.80, 21.98, 21.81, 22.52, 24.04, 31.28, 32.93, 27.51, 22.44, 23.42, 23.98, 24.06, 26.79, 28.02, 27.67, 26.70,
-     21.59, 21.49, 21.88, 22.43, 23.93, 29.13, 32.41, 29.49, 25.62, 27.22, 27.74, 26.82, 25.91, 26.87, 27.51, 27.07,
-     20.64, 21.78, 22.20, 24.70, 26.63, 29.39, 28.56, 26.54, 26.90, 27.14, 28.46, 27.87, 27.43, 27.29, 27.63, 28.22},
-    {20.51, 21.20, 21.45, 21.28, 21.53, 21.66, 21.96, 21.94, 21.76, 21.91, 21.70, 21.56, 21.41, 21.39, 21.31, 21.78,
-     21.51, 21.51, 21.18, 21.74, 21.95, 22.01, 22.25, 22.15, 22.85, 22.87, 22.49, 22.04, 22.00, 21.83, 21.62, 21.58,
-     21.47, 21.52, 21.47, 21.72, 22.00, 22.25, 22.58, 23.33, 24.23, 24.13, 23.70, 22.64, 22.39, 21.83, 22.16, 21.88,
-     21.74, 21.94, 21.47, 21.94, 21.93, 22.77, 23.87, 25.10, 25.49, 25.43, 24.42, 23.70, 22.40, 22.02, 21.59, 21.61,
-     21.58, 21.91, 21.82, 22.01, 22.30, 23.43, 24.57, 25.73, 26.63, 26.52, 25.34, 23.90, 22.66, 22.02, 21.69, 21.76,
-     21.92, 21.97, 21.90, 22.18, 23.01, 27.06, 26.68, 26.10, 26.94, 27.09, 26.10, 24.28, 22.85, 21.98, 22.02, 22.14,
-     21.70, 21.59, 21.95, 22.47, 25.43, 31.70, 31.19, 27.60, 27.46, 27.54, 26.46, 24.97, 23.36, 22.33, 21.93, 21.90,
-     21.72, 22.19, 22.06, 22.71, 26.94, 30.86, 31.22, 28.87, 28.33, 28.21, 27.01, 25.92, 24.32, 23.06, 22.20, 21.71,
-     21.81, 21.83, 21.77, 22.66, 26.47, 32.85, 32.13, 29.00, 27.71, 28.71, 27.96, 26.69, 25.88, 24.11, 22.65, 22.32,
-     21.88, 22.06, 22.20, 22.51, 24.19, 31.06, 32.25, 27.64, 26.50, 28.18, 28.92, 28.37, 26.57, 25.09, 24.35, 23.40,
-     21.96, 21.89, 21.52, 22.49, 23.87, 29.04, 32.27, 28.93, 27.30, 28.36, 29.08, 27.83, 26.81, 26.61, 25.83, 25.27,
-     22.36, 21.78, 22.27, 24.77, 26.20, 29.39, 28.02, 26.96, 27.47, 27.50, 28.96, 27.98, 27.69, 26.93, 26.69, 26.58},
-    {20.23, 21.05, 20.92, 21.30, 21.10, 21.26, 21.46, 21.51, 21.67, 21.70, 21.30, 21.25, 21.29, 21.17, 21.33, 21.71,
-     21.55, 21.21, 21.49, 21.70, 21.68, 21.76, 21.75, 21.67, 21.73, 21.62, 21.64, 21.48, 21.26, 21.43, 21.40, 21.81,
-     21.16, 21.61, 21.49, 21.51, 21.80, 21.83, 21.83, 21.86, 21.92, 21.71, 21.59, 21.66, 21.50, 21.98, 21.28, 21.48,
-     22.01, 21.96, 21.55, 21.85, 21.99, 22.24, 21.93, 21.89, 21.88, 21.84, 21.66, 21.42, 21.47, 21.56, 21.68, 21.56,
-     21.76, 21.86, 21.60, 22.03, 22.45, 22.80, 22.54, 22.08, 21.83, 21.87, 21.86, 21.83, 21.82, 21.63, 21.58, 21.71,
-     21.64, 21.98, 22.09, 22.59, 23.88, 26.02, 25.48, 22.71, 22.07, 21.87, 21.80, 21.68, 21.83, 21.39, 21.58, 21.64,
-     21.80, 21.86, 22.24, 23.67, 26.39, 29.88, 30.18, 25.08, 22.19, 21.94, 21.60, 21.57, 21.91, 21.51, 21.69, 21.39,
-     22.06, 22.02, 22.66, 24.64, 27.57, 28.78, 29.71, 27.07, 22.60, 21.95, 21.65, 21.72, 21.52, 21.64, 21.69, 21.90,
-     22.16, 21.98, 22.55, 24.71, 27.72, 29.17, 28.72, 27.16, 23.33, 22.35, 21.75, 21.62, 21.85, 21.68, 21.92, 21.79,
-     21.92, 22.37, 22.28, 23.27, 25.78, 28.52, 28.36, 26.62, 24.70, 24.15, 23.43, 22.40, 22.06, 21.41, 21.75, 22.04,
-     22.00, 21.75, 22.11, 22.51, 24.00, 28.12, 29.19, 27.65, 27.31, 27.14, 26.04, 25.37, 24.96, 24.58, 24.85, 25.76,
-     21.97, 22.39, 22.38, 24.79, 26.34, 28.96, 28.25, 28.03, 27.95, 27.89, 25.42, 24.96, 25.16, 24.84, 25.07, 24.85},
-    {21.44, 20.78, 21.40, 21.30, 21.48, 21.50, 21.63, 21.50, 21.66, 21.81, 21.24, 21.44, 21.58, 21.26, 21.15, 21.16,
-     21.34, 21.54, 21.49, 21.70, 21.57, 21.66, 21.70, 21.82, 21.43, 21.67, 21.64, 21.71, 21.58, 21.29, 21.24, 21.42,
-     21.41, 21.40, 21.49, 21.57, 22.06, 21.73, 21.69, 21.82, 21.79, 21.71, 21.54, 21.61, 21.62, 21.72, 21.51, 21.48,
-     21.52, 21.62, 21.73, 21.74, 22.09, 22.02, 21.76, 21.85, 21.79, 21.98, 21.75, 21.72, 21.73, 21.56, 21.61, 21.80,
-     21.53, 21.73, 21.72, 22.08, 22.08, 22.20, 21.96, 22.00, 21.87, 21.79, 21.73, 21.87, 21.82, 21.63, 21.65, 21.78,
-     21.64, 22.05, 21.98, 22.19, 22.71, 25.45, 24.98, 21.96, 21.95, 21.87, 21.80, 21.68, 21.82, 21.28, 21.58, 21.71,
-     21.80, 21.41, 22.13, 22.44, 25.05, 31.86, 32.03, 24.66, 21.96, 21.86, 21.81, 21.84, 21.46, 21.51, 21.69, 21.55,
-     22.29, 22.21, 23.07, 24.14, 27.00, 30.71, 32.21, 27.96, 21.88, 21.67, 21.82, 21.58, 21.67, 21.64, 21.89, 21.50,
-     22.00, 22.52, 24.72, 26.35, 27.81, 31.94, 33.15, 27.95, 21.91, 21.81, 21.52, 21.57, 21.64, 21.74, 21.78, 21.71,
-     22.26, 22.74, 24.45, 27.68, 28.61, 29.24, 31.72, 25.79, 22.10, 23.07, 22.91, 22.45, 21.72, 21.78, 21.46, 21.95,
-     22.63, 22.56, 23.14, 26.19, 28.32, 27.82, 27.85, 27.42, 25.72, 26.81, 26.90, 26.56, 25.93, 25.64, 26.01, 26.47,
-     23.43, 22.39, 23.00, 25.19, 26.95, 28.47, 27.87, 26.92, 26.60, 25.82, 25.77, 25.92, 25.29, 25.65, 25.77, 25.56},
-    {20.31, 20.82, 21.12, 21.12, 21.45, 21.29, 21.43, 21.31, 21.19, 21.61, 21.27, 21.08, 21.18, 21.05, 21.10, 20.89,
-     21.39, 20.84, 21.09, 21.41, 21.54, 21.47, 21.21, 21.59, 21.71, 21.29, 21.17, 21.45, 21.55, 21.18, 21.11, 20.99,
-     21.11, 21.43, 21.33, 21.37, 21.47, 21.70, 21.67, 21.48, 21.81, 21.59, 21.81, 21.27, 21.47, 21.49, 21.54, 21.43,
-     21.48, 21.44, 21.39, 21.60, 21.53, 21.99, 21.78, 21.78, 21.73, 21.69, 21.54, 21.39, 21.65, 21.41, 21.23, 21.43,
-     21.41, 21.43, 21.34, 21.59, 21.88, 22.09, 21.81, 21.86, 21.65, 21.76, 21.79, 21.57, 21.64, 21.72, 21.34, 21.28,
-     21.60, 21.49, 21.38, 21.87, 22.59, 25.35, 25.23, 21.98, 21.90, 21.77, 21.69, 21.74, 21.35, 21.52, 21.28, 21.60,
-     21.46, 21.76, 21.93, 21.96, 24.51, 31.88, 31.87, 25.25, 21.74, 21.72, 21.71, 21.55, 21.54, 21.42, 21.40, 21.28,
-     21.79, 22.11, 23.39, 23.25, 26.13, 30.88, 31.74, 28.79, 22.02, 21.56, 21.54, 21.46, 21.54, 21.73, 21.59, 21.30,
-     21.72, 22.55, 25.03, 26.38, 27.56, 32.72, 33.13, 28.56, 21.97, 21.61, 21.45, 21.35, 21.72, 21.36, 21.33, 21.35,
-     21.96, 22.77, 24.86, 28.09, 28.34, 30.29, 32.58, 26.51, 22.07, 22.86, 22.79, 22.16, 21.80, 21.62, 21.49, 22.26,
-     21.93, 22.43, 23.39, 26.52, 28.45, 27.50, 28.59, 28.05, 25.98, 26.78, 26.32, 26.43, 25.59, 25.47, 25.97, 26.52,
-     21.83, 22.24, 22.57, 25.36, 26.98, 28.27, 27.02, 26.52, 26.89, 25.53, 25.45, 25.41, 24.92, 25.68, 25.20, 25.50},
-    {20.14, 21.09, 20.96, 20.70, 21.26, 21.35, 21.38, 21.25, 21.02, 21.27, 21.09, 20.88, 20.75, 21.30, 21.01, 20.89,
-     20.57, 21.09, 21.31, 21.41, 21.60, 21.57, 21.57, 21.54, 21.65, 21.54, 21.55, 21.62, 21.29, 21.18, 20.95, 21.18,
-     21.02, 21.36, 21.13, 21.54, 21.78, 21.80, 21.58, 21.66, 21.54, 21.55, 21.37, 21.48, 21.64, 21.24, 21.25, 21.00,
-     21.72, 21.30, 21.33, 21.49, 21.63, 21.68, 21.78, 21.57, 21.81, 21.74, 21.59, 21.49, 21.76, 21.83, 21.16, 21.27,
-     21.17, 21.37, 21.40, 21.75, 21.92, 21.96, 21.90, 21.81, 21.81, 21.93, 21.53, 21.66, 21.79, 21.78, 21.34, 21.36,
-     21.14, 21.76, 21.78, 22.07, 22.32, 25.10, 25.81, 22.02, 21.81, 21.73, 21.43, 21.65, 21.50, 21.47, 21.22, 21.37,
-     21.61, 21.83, 22.38, 23.35, 24.46, 31.46, 32.26, 26.31, 21.66, 21.80, 21.50, 21.55, 21.59, 21.48, 21.34, 21.58,
-     21.86, 22.51, 24.42, 25.85, 26.89, 30.45, 31.51, 29.70, 21.70, 21.52, 21.54, 21.23, 21.60, 21.38, 21.39, 21.54,
-     21.63, 22.69, 24.80, 27.34, 28.24, 30.05, 32.94, 29.10, 21.77, 21.62, 21.63, 21.35, 21.51, 21.30, 21.27, 21.19,
-     21.69, 22.19, 23.98, 27.32, 28.48, 28.04, 29.77, 26.55, 22.03, 22.86, 22.79, 22.11, 21.74, 21.37, 21.35, 21.38,
-     22.31, 21.96, 22.48, 23.84, 27.21, 28.09, 26.61, 26.12, 25.84, 26.11, 26.02, 26.10, 25.11, 24.74, 25.35, 25.98,
-     21.58, 22.05, 22.26, 24.89, 26.55, 28.39, 27.95, 26.73, 26.78, 24.50, 24.75, 24.92, 24.72, 24.95, 25.29, 24.67},
-    {21.38, 20.93, 21.13, 21.42, 21.53, 21.60, 21.45, 21.38, 21.65, 21.45, 21.70, 21.43, 21.56, 21.54, 21.58, 21.56,
-     21.72, 21.67, 21.82, 21.61, 21.89, 21.75, 21.79, 21.90, 21.87, 21.71, 21.62, 21.52, 21.56, 21.55, 21.45, 22.06,
-     21.82, 21.88, 21.79, 21.84, 21.95, 21.96, 21.91, 21.94, 21.87, 21.88, 21.82, 21.81, 21.71, 21.83, 21.93, 22.14,
-     21.74, 22.21, 22.14, 21.95, 22.22, 22.05, 21.88, 22.09, 21.87, 21.92, 21.78, 21.65, 21.66, 21.66, 21.73, 21.86,
-     22.05, 22.10, 22.11, 22.47, 23.08, 22.79, 22.28, 22.15, 21.95, 22.03, 21.89, 22.10, 22.01, 21.73, 21.83, 21.99,
-     22.22, 22.09, 22.64, 24.12, 24.76, 25.81, 26.21, 22.39, 21.83, 21.98, 22.00, 21.71, 21.81, 21.43, 21.89, 21.92,
-     22.15, 22.23, 23.58, 25.55, 27.15, 28.89, 30.54, 27.19, 21.87, 21.89, 21.85, 21.92, 21.50, 21.66, 21.93, 21.90,
-     22.27, 22.39, 23.75, 26.56, 28.47, 28.24, 29.32, 29.45, 22.11, 21.74, 21.94, 21.71, 21.91, 21.91, 22.13, 22.10,
-     21.90, 22.30, 23.42, 25.78, 27.89, 28.12, 28.26, 27.82, 22.64, 21.92, 21.83, 21.66, 21.79, 22.02, 22.03, 21.85,
-     21.98, 22.20, 22.59, 23.43, 26.12, 28.82, 28.22, 26.65, 24.60, 23.42, 22.95, 22.23, 21.87, 21.83, 21.80, 22.54,
-     22.46, 22.29, 22.51, 22.56, 25.81, 28.59, 28.84, 27.92, 26.98, 26.56, 24.60, 24.97, 24.33, 24.02, 24.67, 25.72,
-     23.85, 22.56, 22.51, 25.04, 26.51, 28.62, 28.56, 28.81, 28.25, 27.24, 25.00, 24.94, 24.87, 24.89, 25.30, 25.64},
-    {20.86, 20.93, 21.30, 21.35, 21.40, 21.60, 21.79, 21.82, 21.70, 21.57, 21.65, 21.29, 21.55, 21.15, 21.12, 21.24,
-     21.41, 21.60, 21.46, 21.87, 22.17, 21.75, 22.09, 21.95, 21.92, 21.86, 21.68, 21.58, 21.56, 21.27, 21.13, 21.68,
-     21.30, 21.37, 21.41, 21.67, 22.31, 22.25, 23.03, 22.84, 22.67, 22.33, 21.72, 21.76, 21.55, 22.09, 21.71, 21.71,
-     21.58, 21.60, 21.59, 21.89, 22.65, 23.84, 24.72, 24.40, 24.07, 23.08, 22.10, 22.05, 21.82, 21.60, 21.38, 21.78,
-     21.66, 21.78, 21.70, 22.57, 23.80, 25.55, 26.05, 25.89, 24.86, 23.63, 22.41, 21.91, 21.96, 21.56, 21.83, 21.76,
-     21.61, 21.84, 21.85, 22.68, 24.90, 27.02, 28.02, 27.27, 25.55, 24.08, 22.43, 22.17, 21.71, 21.87, 21.43, 21.92,
-     21.63, 21.97, 22.12, 23.31, 25.13, 29.72, 29.51, 27.71, 26.15, 24.35, 23.09, 22.01, 21.85, 21.72, 21.54, 21.60,
-     21.65, 21.47, 21.94, 22.45, 25.21, 29.62, 29.20, 28.68, 27.34, 25.50, 24.15, 22.75, 21.76, 21.86, 21.74, 21.55,
-     21.73, 21.76, 21.89, 22.45, 24.53, 30.35, 29.71, 29.04, 28.33, 27.17, 25.31, 23.80, 22.31, 21.73, 21.97, 21.77,
-     21.53, 21.47, 21.88, 22.34, 23.88, 29.64, 30.34, 29.35, 28.83, 28.39, 27.57, 26.16, 23.97, 23.01, 22.10, 22.10,
-     22.46, 21.41, 21.60, 22.06, 23.20, 28.55, 31.06, 29.35, 28.78, 29.20, 29.03, 26.38, 25.24, 24.62, 24.43, 24.17,
-     21.13, 21.48, 22.04, 24.36, 26.20, 28.90, 28.13, 27.33, 27.63, 28.29, 27.49, 26.32, 25.95, 25.48, 25.13, 25.28},
-    {21.03, 21.02, 21.53, 21.49, 21.40, 21.60, 21.62, 21.77, 21.93, 22.20, 22.12, 22.21, 21.98, 21.62, 22.22, 22.54,
-     21.72, 21.43, 21.60, 21.87, 21.84, 21.85, 22.09, 22.30, 22.85, 23.27, 23.77, 23.30, 22.82, 22.25, 21.86, 22.16,
-     21.21, 21.37, 21.60, 22.06, 21.95, 22.06, 22.45, 23.20, 24.36, 25.15, 25.35, 25.01, 24.11, 22.97, 22.75, 22.31,
-     21.50, 21.46, 21.83, 21.95, 21.93, 22.32, 23.05, 24.07, 24.78, 26.09, 26.57, 26.19, 24.90, 23.55, 22.76, 22.51,
-     21.51, 21.78, 21.82, 22.12, 22.08, 22.53, 23.31, 23.96, 25.01, 26.55, 27.74, 27.15, 25.48, 24.18, 22.62, 22.60,
-     21.46, 21.77, 21.96, 22.18, 22.74, 25.68, 27.37, 24.26, 25.59, 27.08, 27.81, 27.87, 26.30, 24.59, 22.86, 22.59,
-     21.55, 22.10, 22.00, 22.23, 24.04, 31.89, 32.09, 28.71, 25.85, 27.69, 28.68, 28.49, 26.97, 25.20, 23.60, 22.88,
-     21.81, 21.60, 22.00, 22.71, 25.03, 30.97, 31.30, 30.77, 25.68, 27.52, 28.91, 29.00, 27.73, 26.04, 24.22, 23.27,
-     21.41, 21.69, 21.95, 22.67, 24.95, 32.73, 33.29, 30.66, 25.25, 26.40, 27.88, 28.78, 28.88, 27.84, 25.59, 23.73,
-     21.54, 21.84, 22.20, 22.46, 23.73, 30.97, 33.09, 29.10, 23.86, 25.21, 26.43, 27.84, 29.06, 27.79, 26.27, 24.60,
-     21.59, 21.41, 22.37, 22.56, 23.60, 28.99, 32.69, 29.90, 25.95, 27.27, 27.99, 27.83, 26.93, 27.07, 26.90, 25.99,
-     20.89, 21.48, 22.67, 24.23, 26.32, 29.17, 28.72, 26.75, 26.74, 27.24, 28.63, 28.40, 27.56, 27.58, 27.38, 27.17},
-    {21.66, 21.31, 21.49, 21.32, 21.64, 21.83, 21.73, 21.82, 21.59, 22.08, 21.94, 22.12, 22.16, 22.36, 22.42, 22.66,
-     21.73, 21.71, 21.50, 22.11, 21.89, 21.80, 22.05, 21.91, 22.03, 21.97, 22.06, 22.95, 23.43, 23.55, 23.18, 22.84,
-     21.50, 21.92, 21.78, 21.72, 22.06, 22.26, 21.97, 21.87, 22.25, 22.12, 22.99, 23.63, 24.83, 25.70, 25.41, 24.54,
-     22.26, 21.84, 21.88, 22.16, 22.33, 22.21, 22.12, 21.99, 22.06, 22.16, 22.48, 23.62, 25.42, 26.82, 26.83, 24.89,
-     21.85, 21.89, 21.99, 22.18, 22.18, 22.47, 22.23, 22.26, 22.18, 22.51, 22.86, 24.24, 26.02, 27.98, 28.00, 26.21,
-     22.03, 22.01, 22.13, 22.34, 22.85, 26.08, 27.55, 22.61, 22.09, 22.48, 23.42, 24.70, 26.98, 28.55, 28.63, 26.90,
-     22.19, 21.89, 21.89, 22.44, 24.15, 31.95, 32.66, 28.55, 22.33, 22.17, 23.04, 24.86, 26.47, 28.01, 28.73, 27.48,
-     21.99, 21.98, 22.29, 22.46, 24.87, 31.08, 32.04, 31.36, 22.42, 22.09, 22.39, 23.63, 24.82, 26.70, 28.51, 28.15,
-     21.93, 21.87, 21.94, 22.67, 25.15, 32.79, 33.51, 30.57, 22.75, 22.08, 22.03, 22.34, 23.31, 25.42, 28.11, 27.59,
-     22.09, 22.39, 22.06, 22.80, 24.04, 31.21, 33.36, 29.03, 22.73, 22.76, 22.35, 22.18, 22.38, 23.92, 25.88, 26.97,
-     21.83, 22.09, 21.85, 22.48, 23.82, 29.24, 32.60, 30.09, 25.77, 27.09, 27.39, 26.06, 23.14, 23.05, 25.32, 26.73,
-     23.24, 22.09, 22.23, 24.81, 26.68, 29.61, 28.88, 26.64, 26.90, 27.40, 28.50, 27.74, 26.33, 25.14, 26.19, 26.45},
-    {20.71, 21.44, 21.51, 21.84, 21.79, 21.67, 21.92, 21.84, 21.89, 21.87, 21.83, 21.69, 21.83, 21.53, 21.82, 22.27,
-     21.87, 21.81, 21.74, 21.75, 21.91, 21.82, 22.17, 22.08, 21.99, 22.14, 22.07, 22.05, 22.07, 22.18, 22.16, 22.88,
-     21.62, 21.80, 22.06, 21.80, 22.28, 22.18, 22.12, 22.02, 21.95, 22.18, 21.99, 21.93, 21.90, 22.41, 23.33, 23.98,
-     21.48, 21.94, 22.15, 22.18, 22.35, 22.08, 22.35, 22.38, 22.12, 22.13, 22.09, 22.07, 22.16, 22.56, 23.98, 25.71,
-     22.03, 21.98, 21.95, 22.45, 22.57, 22.65, 22.32, 22.31, 22.27, 22.11, 22.19, 22.27, 22.23, 23.29, 25.29, 27.26,
-     22.06, 21.84, 22.03, 22.36, 22.96, 26.57, 27.49, 22.94, 22.38, 22.06, 22.25, 21.93, 22.04, 22.93, 25.73, 27.58,
-     21.99, 21.98, 22.13, 22.60, 24.47, 32.07, 32.67, 28.46, 21.99, 22.09, 22.26, 21.91, 22.02, 22.23, 24.05, 26.57,
-     22.33, 22.20, 22.43, 22.53, 25.42, 30.61, 32.68, 31.26, 22.48, 22.10, 22.02, 21.74, 22.09, 22.22, 22.79, 25.48,
-     21.64, 21.96, 22.08, 22.79, 25.35, 33.16, 33.48, 31.04, 22.47, 22.21, 21.86, 22.12, 22.07, 21.86, 22.51, 24.65,
-     21.77, 21.76, 22.14, 22.65, 24.11, 31.44, 33.50, 29.38, 22.61, 22.50, 22.50, 22.15, 22.23, 21.71, 22.24, 24.31,
-     21.76, 21.72, 21.88, 22.63, 24.00, 28.96, 32.76, 30.61, 25.74, 27.01, 27.16, 25.70, 22.92, 22.19, 22.12, 25.14,
-     21.88, 21.64, 22.42, 24.91, 26.64, 29.68, 29.38, 26.66, 26.92, 27.37, 28.18, 27.41, 26.69, 23.69, 22.71, 25.68},
-    {21.62, 21.41, 21.64, 21.24, 21.62, 21.57, 21.58, 21.90, 21.67, 21.93, 21.61, 21.71, 21.37, 21.58, 21.62, 21.28,
-     21.35, 21.63, 21.63, 21.89, 21.86, 21.66, 21.86, 21.87, 21.64, 22.03, 21.91, 21.83, 21.65, 21.23, 21.65, 22.19,
-     21.59, 21.40, 21.62, 21.74, 21.60, 22.07, 22.06, 21.96, 21.88, 21.80, 21.69, 21.35, 21.73, 21.86, 22.18, 22.00,
-     21.69, 21.76, 21.92, 21.91, 21.95, 22.11, 22.07, 21.89, 22.01, 22.06, 21.98, 21.77, 21.89, 21.68, 21.68, 22.14,
-     21.45, 21.80, 21.78, 22.28, 22.32, 22.42, 22.13, 22.12, 22.04, 22.08, 21.82, 21.74, 21.97, 21.69, 21.78, 22.85,
-     21.79, 21.93, 21.98, 22.35, 22.98, 27.07, 26.57, 22.51, 21.92, 21.88, 22.06, 22.00, 21.83, 21.39, 21.72, 22.47,
-     21.65, 21.74, 22.14, 22.54, 25.10, 32.47, 32.35, 27.31, 22.12, 21.79, 22.02, 21.89, 21.86, 21.79, 21.83, 22.01,
-     21.83, 21.69, 22.14, 22.72, 25.80, 30.63, 33.03, 30.71, 22.20, 21.75, 21.83, 21.86, 21.78, 21.59, 21.83, 21.74,
-     21.60, 21.65, 22.38, 22.79, 26.03, 33.26, 33.11, 30.36, 22.41, 21.77, 21.84, 21.62, 21.65, 21.87, 21.72, 22.04,
-     21.21, 21.87, 22.03, 22.76, 24.72, 32.04, 33.27, 29.11, 22.37, 22.44, 22.06, 21.57, 21.61, 21.60, 21.98, 21.78,
-     22.27, 21.69, 21.55, 22.33, 24.12, 29.15, 32.70, 30.37, 25.68, 26.38, 26.75, 25.37, 22.12, 22.01, 21.77, 22.17,
-     21.74, 21.92, 22.15, 24.73, 26.22, 29.41, 29.12, 26.66, 26.86, 27.05, 27.79, 27.12, 25.43, 22.99, 22.15, 22.68},
-    {21.42, 21.21, 21.30, 21.22, 21.60, 21.72, 21.56, 21.55, 21.82, 21.63, 21.41, 21.63, 21.42, 21.32, 21.50, 21.59,
-     21.74, 21.44, 21.68, 21.62, 21.67, 21.69, 21.63, 21.70, 21.77, 21.91, 21.73, 21.70, 21.82, 21.35, 21.55, 21.89,
-     21.40, 21.81, 21.80, 21.73, 22.00, 22.05, 21.72, 21.67, 22.00, 21.65, 21.72, 21.44, 21.77, 21.84, 21.57, 21.98,
-     21.75, 21.67, 21.78, 21.67, 22.32, 22.14, 21.83, 22.05, 21.91, 21.83, 21.78, 21.90, 21.88, 21.72, 21.60, 22.12,
-     21.83, 21.98, 21.76, 21.86, 22.21, 22.31, 22.15, 22.19, 21.98, 21.98, 21.80, 21.77, 21.85, 21.85, 21.70, 21.85,
-     21.78, 21.84, 21.85, 22.33, 23.42, 27.50, 26.06, 22.15, 22.06, 21.82, 21.83, 21.85, 21.86, 21.37, 21.44, 21.78,
-     21.79, 21.91, 21.78, 22.38, 26.25, 32.80, 32.45, 26.66, 22.14, 21.69, 21.84, 21.74, 21.85, 21.83, 21.87, 21.84,
-     21.97, 21.94, 22.07, 22.96, 26.41, 31.49, 33.02, 30.25, 22.19, 21.90, 21.81, 21.52, 21.71, 22.09, 22.08, 21.73,
-     22.15, 22.10, 22.13, 22.93, 27.16, 33.49, 32.60, 29.93, 22.14, 21.96, 21.78, 21.41, 21.74, 21.61, 21.49, 21.78,
-     21.81, 21.77, 22.33, 22.69, 25.46, 32.42, 33.01, 28.59, 22.13, 22.24, 22.09, 21.92, 21.76, 21.90, 21.59, 21.77,
-     21.36, 21.98, 22.16, 22.50, 24.15, 29.43, 32.55, 30.45, 25.90, 26.13, 26.74, 25.41, 22.42, 21.85, 22.00, 21.78,
-     22.44, 22.18, 22.52, 24.78, 26.51, 29.56, 29.05, 26.65, 26.43, 27.09, 27.61, 27.23, 26.17, 23.04, 21.95, 22.17},
-    {20.56, 20.95, 21.54, 21.64, 21.66, 21.90, 21.79, 21.83, 21.48, 21.52, 21.83, 21.69, 21.77, 21.64, 21.60, 21.48,
-     21.64, 21.61, 21.61, 21.56, 21.84, 21.70, 21.94, 21.66, 21.67, 21.86, 22.00, 21.81, 21.76, 21.14, 21.14, 21.22,
-     21.57, 21.60, 21.54, 21.56, 21.79, 21.91, 21.95, 21.80, 22.00, 21.79, 21.77, 21.65, 21.66, 21.65, 21.57, 22.07,
-     21.84, 21.67, 21.90, 21.89, 21.84, 22.05, 22.18, 21.88, 21.83, 21.75, 22.05, 21.90, 21.72, 21.61, 21.74, 22.04,
-     21.82, 21.65, 21.88, 21.96, 22.30, 22.27, 22.11, 21.99, 21.78, 21.90, 21.85, 21.82, 21.75, 21.68, 21.90, 22.07,
-     21.62, 21.84, 22.08, 22.48, 23.69, 27.58, 25.79, 22.30, 21.78, 21.98, 21.83, 21.94, 21.76, 21.49, 21.90, 22.08,
-     21.86, 21.91, 22.29, 22.77, 26.77, 32.69, 32.56, 26.36, 21.91, 21.65, 21.88, 22.10, 21.65, 21.67, 21.68, 21.61,
-     21.74, 21.81, 22.24, 22.91, 26.90, 31.88, 33.09, 30.09, 22.03, 21.86, 21.73, 21.75, 21.71, 21.81, 21.88, 21.88,
-     21.50, 21.70, 22.36, 22.87, 27.93, 33.41, 32.91, 29.66, 22.19, 21.92, 21.78, 21.75, 21.52, 21.79, 21.63, 21.70,
-     21.99, 21.92, 22.53, 23.15, 25.66, 32.73, 33.14, 28.59, 22.17, 22.33, 22.19, 21.71, 21.76, 21.90, 21.96, 22.03,
-     21.86, 21.42, 22.16, 22.75, 24.10, 29.62, 32.64, 30.90, 25.85, 25.98, 26.59, 25.14, 22.42, 21.86, 21.75, 21.87,
-     21.69, 21.79, 23.07, 25.04, 26.45, 29.50, 29.32, 26.80, 26.22, 27.03, 27.55, 27.16, 25.89, 22.75, 22.22, 22.29},
-    {21.12, 21.16, 21.81, 21.39, 21.82, 21.46, 21.88, 21.97, 21.68, 21.77, 21.80, 21.66, 21.59, 21.58, 21.63, 21.95,
-     21.46, 21.07, 21.78, 21.90, 21.81, 22.04, 22.02, 21.78, 21.94, 22.04, 21.70, 21.84, 21.60, 21.30, 21.41, 21.83,
-     21.61, 21.41, 21.57, 21.93, 21.82, 21.89, 22.07, 21.92, 21.98, 22.04, 21.85, 22.04, 21.80, 21.74, 21.90, 21.84,
-     21.62, 21.56, 21.93, 22.03, 22.01, 21.98, 22.07, 21.99, 21.81, 21.82, 21.99, 22.07, 21.90, 21.99, 21.97, 22.47,
-     21.62, 22.01, 21.96, 22.04, 22.19, 22.04, 22.18, 22.05, 21.93, 22.05, 21.96, 21.98, 21.88, 21.59, 21.86, 22.33,
-     21.88, 21.87, 22.27, 22.71, 23.72, 27.72, 25.38, 22.13, 21.93, 22.00, 22.03, 21.96, 21.94, 21.84, 21.86, 21.88,
-     21.82, 21.88, 22.37, 23.00, 27.60, 32.75, 32.25, 25.89, 21.97, 21.76, 21.91, 21.86, 21.87, 21.91, 22.03, 22.32,
-     21.69, 22.10, 22.56, 23.04, 27.19, 32.18, 33.04, 29.77, 22.02, 21.88, 21.92, 21.96, 21.79, 21.54, 21.84, 22.15,
-     21.70, 22.07, 22.28, 23.43, 28.36, 33.30, 32.54, 29.53, 22.17, 22.03, 21.98, 21.83, 21.71, 21.52, 22.14, 21.97,
-     22.20, 21.95, 22.49, 23.12, 26.19, 32.88, 33.11, 28.44, 22.33, 22.08, 22.31, 21.79, 21.79, 21.48, 21.77, 22.23,
-     21.78, 22.02, 22.06, 22.71, 24.41, 29.84, 32.76, 30.74, 25.93, 26.10, 26.97, 25.05, 22.51, 21.81, 22.18, 22.19,
-     23.00, 22.12, 22.71, 25.28, 26.90, 29.64, 29.66, 26.73, 26.40, 27.11, 27.46, 27.01, 25.99, 22.85, 22.07, 22.57},
-    {21.81, 21.25, 21.34, 21.46, 21.88, 21.81, 21.48, 21.52, 21.57, 21.71, 21.50, 21.26, 21.80, 21.90, 21.63, 21.62,
-     22.28, 21.56, 21.29, 21.77, 21.92, 21.93, 21.61, 21.73, 22.09, 22.04, 21.60, 21.49, 21.78, 21.38, 20.92, 21.54,
-     22.03, 21.99, 21.83, 21.47, 22.33, 22.03, 21.84, 21.83, 22.16, 22.18, 21.94, 21.52, 22.20, 21.87, 21.68, 21.93,
-     22.03, 22.25, 21.62, 21.97, 22.10, 22.12, 22.08, 21.86, 22.06, 22.03, 21.76, 21.78, 21.74, 21.93, 21.49, 22.07,
-     22.09, 22.01, 21.68, 21.99, 22.46, 22.39, 21.97, 22.13, 22.17, 22.13, 21.87, 21.56, 22.08, 21.94, 21.59, 21.80,
-     21.96, 22.39, 22.11, 22.21, 24.25, 27.68, 24.87, 22.05, 22.01, 22.28, 21.86, 21.87, 21.99, 21.62, 21.53, 21.96,
-     21.89, 22.01, 22.26, 22.60, 27.90, 32.75, 31.82, 25.29, 21.97, 22.12, 21.87, 21.77, 21.92, 21.86, 21.51, 21.56,
-     21.92, 22.16, 22.27, 22.94, 27.67, 32.41, 32.89, 28.89, 22.09, 22.09, 21.75, 21.73, 21.89, 22.00, 21.71, 21.83,
-     21.78, 22.14, 21.92, 22.90, 28.77, 33.54, 32.54, 28.90, 22.13, 21.91, 21.76, 21.39, 21.71, 21.94, 21.59, 21.81,
-     22.11, 22.10, 22.11, 23.00, 26.64, 32.97, 32.99, 27.75, 22.33, 22.36, 22.02, 21.84, 21.90, 21.74, 22.06, 21.36,
-     22.66, 22.10, 22.12, 22.78, 24.57, 30.04, 32.62, 30.42, 25.97, 26.25, 26.51, 25.22, 22.51, 21.88, 21.78, 21.53,
-     23.73, 22.13, 22.48, 24.87, 26.84, 29.75, 29.39, 26.51, 26.61, 27.06, 27.52, 27.25, 25.78, 22.85, 22.07, 21.95},
-    {21.88, 21.28, 20.80, 21.41, 21.65, 21.65, 21.38, 21.42, 21.69, 21.73, 21.51, 21.28, 21.83, 21.53, 20.74, 21.55,
-     21.40, 21.74, 21.52, 21.47, 21.94, 21.79, 21.47, 21.59, 21.71, 21.75, 21.66, 21.57, 21.74, 21.61, 21.19, 21.67,
-     21.81, 21.79, 21.46, 21.37, 21.94, 21.76, 21.67, 21.84, 21.77, 21.91, 21.61, 21.43, 21.65, 21.76, 21.47, 21.27,
-     21.65, 21.86, 21.70, 21.83, 22.07, 22.08, 21.87, 21.87, 22.03, 21.83, 21.64, 21.84, 21.81, 21.89, 21.58, 21.93,
-     21.57, 22.03, 21.63, 22.05, 22.29, 22.18, 22.06, 21.90, 21.94, 21.93, 21.84, 21.99, 22.10, 21.72, 21.68, 21.67,
-     21.98, 21.95, 21.84, 22.22, 23.91, 27.49, 24.76, 21.70, 21.98, 21.93, 21.82, 21.52, 22.00, 21.58, 21.48, 21.30,
-     21.99, 21.96, 21.94, 22.71, 27.95, 32.76, 31.83, 24.68, 21.86, 21.88, 21.71, 21.60, 21.69, 21.87, 21.53, 21.66,
-     22.26, 22.25, 22.23, 22.85, 27.77, 31.87, 32.97, 28.75, 22.02, 21.85, 21.55, 21.70, 21.75, 21.79, 21.92, 21.78,
-     21.97, 22.15, 22.23, 23.02, 28.29, 33.43, 32.62, 28.33, 21.98, 21.87, 21.64, 21.50, 21.72, 21.83, 21.47, 21.76,
-     21.97, 22.05, 21.99, 22.85, 26.31, 32.71, 32.83, 27.50, 22.30, 22.37, 21.94, 21.65, 21.75, 21.75, 21.65, 21.57,
-     22.32, 21.96, 22.15, 22.48, 24.20, 29.90, 32.54, 30.53, 25.84, 25.97, 26.68, 25.01, 22.15, 22.25, 21.73, 21.66,
-     22.60, 22.15, 22.58, 24.83, 26.43, 29.65, 29.30, 26.63, 26.37, 27.18, 27.31, 27.09, 25.74, 23.10, 21.83, 21.64},
-    {21.19, 21.10, 21.21, 21.27, 21.33, 21.77, 21.32, 21.59, 21.64, 21.50, 21.45, 21.41, 21.33, 21.14, 21.48, 21.66,
-     21.60, 21.34, 21.38, 21.54, 21.88, 21.53, 21.47, 21.84, 21.51, 21.75, 21.72, 21.51, 21.55, 21.26, 21.20, 21.28,
-     21.03, 21.51, 21.52, 21.60, 21.78, 21.76, 21.58, 21.71, 21.77, 21.73, 21.76, 21.48, 21.76, 21.37, 21.48, 21.44,
-     21.57, 21.52, 21.88, 22.04, 21.87, 21.95, 22.00, 21.83, 21.86, 21.83, 21.73, 21.69, 21.71, 21.59, 21.58, 21.43,
-     21.80, 21.50, 21.86, 21.80, 22.06, 22.31, 22.02, 21.98, 21.94, 21.93, 21.75, 21.71, 21.69, 21.43, 21.88, 21.75,
-     21.75, 21.63, 22.18, 22.52, 23.50, 27.57, 25.23, 21.98, 21.90, 21.93, 21.74, 21.84, 21.55, 21.20, 21.62, 21.83,
-     21.84, 21.64, 21.99, 22.66, 27.02, 32.60, 32.19, 24.87, 21.86, 21.81, 21.75, 21.87, 21.54, 21.60, 21.60, 21.81,
-     21.79, 21.85, 22.29, 22.65, 27.37, 30.85, 32.82, 28.67, 21.98, 21.77, 21.55, 21.65, 21.85, 21.91, 21.86, 21.62,
-     21.64, 21.95, 22.11, 23.02, 27.42, 33.20, 32.82, 28.91, 21.98, 21.87, 21.73, 21.55, 21.62, 21.60, 21.68, 21.60,
-     21.52, 21.83, 22.25, 22.79, 25.40, 32.41, 33.00, 27.80, 22.08, 22.00, 22.13, 21.75, 21.75, 21.63, 21.43, 21.74,
-     22.32, 21.72, 21.93, 22.67, 24.09, 29.61, 32.54, 30.48, 25.65, 26.07, 26.68, 25.01, 22.02, 21.84, 21.49, 21.65,
-     22.35, 21.76, 22.03, 24.96, 26.43, 29.49, 29.36, 26.68, 26.41, 26.91, 27.48, 26.91, 25.60, 22.50, 22.19, 22.00},
-    {21.03, 21.02, 20.89, 21.21, 21.40, 21.36, 21.45, 21.49, 21.70, 21.68, 21.34, 21.29, 21.27, 20.91, 20.93, 21.34,
-     21.61, 21.10, 20.97, 21.61, 21.67, 21.64, 21.68, 21.50, 21.72, 21.55, 21.67, 21.40, 21.56, 21.12, 21.12, 21.58,
-     21.21, 21.73, 21.40, 21.50, 21.74, 21.86, 21.54, 21.85, 21.73, 21.65, 21.62, 21.60, 21.66, 21.83, 21.33, 21.36,
-     21.33, 21.73, 21.34, 21.62, 21.79, 21.73, 21.83, 21.80, 21.78, 21.83, 21.74, 21.65, 21.82, 21.90, 21.17, 21.77,
-     21.50, 21.71, 21.59, 21.81, 22.26, 22.06, 21.99, 21.87, 21.91, 21.82, 21.89, 21.58, 21.55, 21.61, 21.22, 21.76,
-     21.76, 21.70, 21.51, 22.13, 23.06, 27.34, 26.25, 22.27, 22.02, 22.06, 21.79, 21.71, 21.46, 21.37, 21.03, 21.69,
-     21.85, 21.84, 21.72, 22.47, 25.78, 32.34, 32.27, 26.44, 21.79, 21.73, 21.51, 21.61, 21.75, 21.38, 21.67, 21.44,
-     21.80, 21.86, 21.77, 22.55, 26.41, 29.94, 32.72, 29.75, 21.99, 21.65, 21.47, 21.52, 21.71, 21.86, 21.67, 21.55,
-     21.73, 21.69, 21.77, 22.61, 26.01, 32.93, 32.94, 29.54, 22.15, 21.71, 21.69, 21.61, 21.42, 21.43, 21.55, 21.53,
-     21.36, 21.47, 22.00, 22.46, 24.55, 31.94, 32.97, 28.58, 22.17, 22.24, 21.90, 21.81, 21.64, 21.89, 21.58, 21.84,
-     21.83, 21.57, 21.67, 22.18, 23.59, 29.28, 32.36, 30.63, 25.71, 25.98, 26.38, 24.97, 21.91, 21.71, 21.74, 21.01,
-     22.37, 21.67, 22.27, 24.84, 26.26, 29.44, 29.04, 26.48, 26.32, 26.92, 27.31, 26.68, 25.82, 22.50, 22.02, 22.01},
-    {21.20, 21.02, 20.98, 21.42, 21.40, 21.48, 21.39, 21.43, 21.54, 21.40, 21.16, 21.10, 21.13, 21.07, 21.40, 20.90,
-     21.00, 21.27, 21.46, 21.29, 21.72, 21.53, 21.63, 21.65, 21.62, 21.50, 21.40, 21.40, 21.56, 21.27, 21.13, 21.29,
-     21.12, 21.59, 21.34, 21.38, 21.94, 21.77, 21.73, 21.71, 21.69, 21.83, 21.43, 21.23, 21.66, 21.25, 21.48, 21.19,
-     21.25, 21.39, 21.47, 21.61, 21.98, 21.69, 21.70, 21.88, 21.95, 21.79, 21.69, 21.60, 21.50, 21.42, 21.59, 21.61,
-     21.66, 21.32, 21.82, 21.76, 22.12, 22.15, 22.12, 21.95, 21.83, 21.98, 21.72, 21.86, 21.95, 21.56, 20.89, 21.68,
-     21.46, 21.51, 21.79, 22.28, 22.70, 26.42, 28.06, 22.93, 21.90, 21.74, 21.79, 21.71, 21.71, 21.32, 21.49, 21.76,
-     21.55, 21.78, 21.78, 22.47, 24.21, 31.70, 32.67, 29.22, 22.10, 21.65, 21.76, 21.74, 21.60, 21.44, 21.41, 21.75,
-     21.49, 21.93, 21.71, 22.55, 24.72, 30.10, 32.12, 31.56, 22.35, 21.62, 21.77, 21.75, 21.61, 21.63, 21.34, 21.71,
-     21.41, 21.49, 21.83, 22.19, 24.76, 32.61, 33.18, 31.08, 22.60, 21.71, 21.56, 21.41, 21.57, 21.49, 21.48, 22.00,
-     21.44, 21.62, 22.01, 22.40, 23.73, 30.97, 33.05, 30.11, 22.31, 22.10, 21.85, 21.56, 21.64, 21.58, 21.88, 21.83,
-     21.96, 21.73, 21.94, 22.24, 23.43, 28.55, 32.46, 30.90, 25.90, 25.98, 26.48, 25.13, 22.47, 21.85, 21.42, 21.76,
-     21.63, 21.68, 22.35, 24.84, 26.44, 29.50, 29.26, 26.64, 26.32, 26.98, 27.20, 26.98, 25.68, 22.73, 21.66, 22.50},
-    {20.17, 20.67, 20.82, 21.29, 21.28, 21.43, 21.68, 21.55, 21.38, 21.23, 21.71, 21.43, 21.21, 20.76, 21.22, 21.90,
-     21.32, 20.87, 21.75, 21.30, 21.62, 21.54, 21.59, 21.46, 21.33, 21.66, 21.47, 21.76, 21.19, 20.99, 21.13, 21.40,
-     21.48, 21.23, 21.67, 21.34, 21.44, 21.92, 21.64, 21.73, 21.74, 21.52, 21.49, 21.76, 21.27, 21.33, 21.19, 21.37,
-     21.10, 21.67, 21.54, 21.73, 21.46, 21.70, 21.93, 21.85, 21.71, 21.63, 21.47, 21.61, 21.51, 21.55, 21.53, 21.54,
-     21.28, 21.46, 21.88, 21.87, 21.85, 21.94, 22.08, 22.12, 21.95, 21.74, 21.77, 21.64, 21.71, 21.33, 21.70, 21.69,
-     21.47, 21.26, 21.80, 21.99, 22.25, 25.20, 29.09, 24.61, 21.96, 21.79, 21.88, 21.67, 21.62, 21.10, 21.17, 21.85,
-     21.11, 21.47, 21.61, 22.18, 22.99, 30.62, 32.60, 31.23, 22.39, 21.74, 21.64, 21.61, 21.56, 21.67, 21.74, 21.76,
-     21.27, 21.61, 21.89, 22.16, 23.32, 30.35, 30.70, 32.57, 23.48, 21.79, 21.65, 21.48, 21.52, 21.40, 21.61, 21.17,
-     21.66, 21.56, 21.96, 22.20, 23.50, 31.94, 33.46, 31.97, 23.37, 21.85, 21.70, 21.57, 21.53, 21.26, 21.56, 21.69,
-     21.28, 21.63, 21.95, 22.01, 23.33, 29.64, 33.02, 31.12, 22.58, 22.11, 22.15, 21.72, 21.59, 21.39, 21.66, 21.58,
-     21.09, 21.42, 21.89, 22.06, 23.21, 28.01, 32.74, 31.09, 26.10, 25.94, 26.39, 25.20, 22.11, 21.65, 21.35, 21.39,
-     21.40, 21.78, 22.44, 24.44, 25.97, 29.34, 29.27, 26.86, 26.28, 26.72, 27.04, 27.11, 25.62, 22.51, 21.85, 21.65},
-    {19.77, 20.51, 21.65, 21.33, 21.39, 21.66, 21.62, 21.55, 21.55, 21.52, 21.64, 21.41, 21.46, 21.04, 20.88, 21.47,
-     21.33, 21.23, 21.37, 21.60, 21.62, 21.65, 21.80, 21.77, 21.74, 21.72, 21.69, 21.75, 21.17, 21.46, 21.57, 21.61,
-     21.68, 21.21, 21.98, 21.73, 21.96, 21.84, 21.80, 21.61, 21.76, 21.86, 21.65, 21.82, 21.66, 21.44, 21.53, 21.31,
-     21.62, 21.51, 21.59, 21.95, 21.62, 22.17, 22.08, 21.78, 21.99, 21.87, 21.99, 21.82, 21.78, 21.60, 21.57, 21.73,
-     21.55, 21.77, 21.88, 22.03, 22.15, 22.05, 22.15, 22.19, 22.06, 21.94, 21.66, 22.03, 21.97, 21.56, 21.61, 21.80,
-     21.89, 21.76, 21.74, 21.90, 22.13, 23.91, 29.08, 26.02, 22.02, 22.10, 22.08, 21.65, 21.53, 21.38, 21.87, 21.58,
-     21.60, 21.45, 21.95, 22.10, 22.70, 29.13, 32.35, 31.98, 23.81, 22.09, 21.92, 21.59, 21.72, 21.73, 21.79, 21.64,
-     21.85, 21.66, 21.95, 21.91, 23.25, 30.01, 30.27, 33.01, 25.17, 21.78, 21.85, 21.82, 21.57, 21.57, 21.59, 21.51,
-     21.70, 21.41, 21.71, 22.20, 23.19, 31.03, 33.33, 32.71, 24.73, 21.75, 21.90, 21.63, 21.69, 21.85, 21.74, 21.65,
-     21.84, 21.52, 21.81, 22.18, 23.02, 28.62, 33.08, 32.13, 23.05, 22.27, 22.07, 21.73, 21.76, 21.57, 21.55, 21.95,
-     21.34, 21.30, 22.00, 22.24, 23.27, 27.18, 32.61, 31.42, 26.48, 25.76, 26.55, 25.47, 22.09, 21.76, 21.78, 21.50,
-     22.28, 21.91, 22.24, 24.96, 26.26, 29.18, 29.32, 26.71, 26.44, 27.09, 27.26, 26.97, 25.93, 22.93, 22.05, 22.01},
-    {20.89, 20.72, 21.20, 21.14, 21.54, 21.38, 21.70, 21.57, 21.79, 21.42, 21.48, 21.50, 21.13, 21.53, 21.55, 21.40,
-     21.16, 21.25, 21.47, 21.69, 21.69, 21.67, 21.61, 21.84, 22.00, 21.74, 21.65, 21.89, 21.64, 21.20, 21.27, 21.36,
-     21.45, 21.37, 21.68, 21.69, 21.87, 21.95, 21.72, 21.89, 22.04, 21.87, 21.71, 21.84, 21.62, 21.59, 21.48, 21.26,
-     21.48, 21.60, 21.42, 21.86, 21.92, 22.00, 22.05, 22.09, 21.96, 21.83, 21.87, 21.69, 22.01, 21.80, 21.87, 21.51,
-     21.65, 21.72, 21.84, 21.84, 21.93, 22.14, 22.16, 22.00, 22.15, 22.03, 21.98, 21.62, 21.83, 21.69, 21.70, 21.91,
-     21.61, 21.52, 21.42, 21.86, 22.24, 23.42, 28.37, 27.13, 22.31, 21.99, 21.83, 21.75, 21.84, 21.23, 21.64, 21.91,
-     21.40, 21.67, 21.86, 22.06, 22.66, 27.67, 32.28, 32.42, 24.99, 21.98, 21.76, 21.83, 21.49, 21.63, 21.75, 22.12,
-     21.57, 21.68, 21.73, 21.97, 22.67, 29.46, 29.63, 32.83, 26.92, 21.95, 21.73, 21.65, 21.79, 21.59, 21.88, 21.86,
-     21.49, 21.29, 21.85, 22.17, 23.01, 30.27, 33.18, 32.87, 25.85, 22.14, 21.87, 21.59, 21.76, 21.74, 21.56, 21.68,
-     21.16, 21.54, 21.50, 22.19, 22.83, 27.63, 32.88, 32.56, 23.68, 22.51, 22.27, 21.79, 21.55, 22.03, 21.58, 21.82,
-     21.77, 21.73, 22.23, 22.01, 23.28, 27.09, 32.90, 31.75, 26.97, 25.87, 26.87, 25.54, 22.43, 21.99, 21.49, 21.73,
-     22.39, 21.55, 22.19, 24.71, 25.85, 29.25, 29.23, 26.99, 26.51, 26.90, 27.16, 27.12, 26.70, 22.73, 21.90, 21.94},
-    {20.76, 20.43, 21.09, 21.24, 21.43, 21.39, 21.47, 21.57, 21.17, 21.25, 21.31, 21.52, 21.02, 20.79, 21.25, 20.95,
-     21.35, 21.22, 21.35, 21.45, 21.35, 21.61, 21.45, 21.82, 21.39, 21.53, 21.43, 21.54, 21.52, 21.23, 21.33, 21.62,
-     20.55, 21.19, 21.37, 21.64, 21.61, 21.69, 21.93, 21.78, 21.75, 21.72, 21.60, 21.51, 21.23, 21.54, 21.14, 21.14,
-     21.29, 21.35, 21.43, 21.58, 21.52, 21.84, 21.85, 21.86, 21.67, 21.64, 21.53, 21.48, 21.37, 21.51, 21.48, 21.32,
-     21.14, 21.41, 21.67, 21.73, 21.45, 21.86, 22.22, 22.29, 21.76, 21.80, 21.87, 21.74, 21.62, 21.47, 21.52, 22.02,
-     21.49, 21.48, 21.70, 22.00, 21.94, 22.65, 27.50, 27.92, 22.35, 21.80, 21.85, 21.87, 21.43, 21.29, 21.39, 21.72,
-     21.35, 21.36, 21.57, 22.10, 22.37, 25.91, 32.15, 32.53, 26.62, 21.83, 21.57, 21.76, 21.52, 21.41, 21.51, 22.09,
-     21.68, 21.43, 21.73, 22.12, 22.74, 28.06, 29.60, 32.73, 28.42, 22.12, 21.87, 21.68, 21.58, 21.60, 21.83, 21.67,
-     21.12, 21.45, 21.55, 22.00, 22.47, 29.01, 33.20, 32.92, 26.99, 21.90, 21.94, 21.67, 21.44, 21.75, 21.86, 21.64,
-     20.94, 21.20, 21.71, 21.79, 22.56, 26.70, 32.74, 32.70, 24.05, 22.22, 22.40, 21.53, 21.32, 21.60, 21.25, 21.18,
-     21.63, 21.04, 21.83, 22.02, 23.17, 26.63, 32.57, 31.73, 27.18, 25.71, 26.61, 25.81, 22.75, 21.67, 21.85, 21.71,
-     20.45, 21.61, 22.38, 24.66, 25.79, 29.14, 29.66, 26.98, 26.39, 26.89, 27.11, 27.18, 26.05, 22.99, 21.79, 22.07},
-    {20.36, 20.59, 21.31, 21.09, 21.23, 21.38, 21.41, 21.29, 21.73, 21.59, 21.48, 21.51, 21.15, 21.17, 21.42, 21.37,
-     21.53, 21.69, 21.77, 21.82, 21.58, 21.71, 21.65, 21.87, 21.54, 21.58, 21.42, 21.66, 21.39, 21.22, 21.23, 21.70,
-     21.24, 21.46, 21.43, 21.46, 21.71, 21.79, 21.79, 21.92, 21.75, 21.72, 21.60, 21.72, 21.62, 21.92, 21.73, 21.56,
-     21.35, 21.61, 21.85, 21.80, 21.96, 22.07, 21.85, 22.07, 21.89, 21.77, 21.80, 22.17, 21.84, 21.50, 21.54, 21.96,
-     21.53, 21.60, 21.78, 21.68, 21.77, 22.03, 22.18, 22.33, 22.01, 22.01, 21.96, 21.79, 21.62, 21.64, 21.78, 21.93,
-     21.78, 21.40, 21.64, 21.75, 22.04, 22.65, 27.20, 28.67, 22.75, 22.04, 21.98, 22.14, 21.58, 21.50, 21.91, 21.94,
-     21.43, 21.67, 21.80, 22.05, 22.20, 24.90, 32.07, 32.70, 28.25, 21.96, 21.74, 21.76, 21.67, 21.35, 21.69, 21.62,
-     21.59, 21.69, 21.73, 22.17, 22.33, 27.32, 29.79, 32.54, 30.08, 22.16, 22.01, 21.50, 21.73, 21.53, 21.69, 21.73,
-     21.11, 21.37, 21.85, 21.89, 22.71, 28.06, 33.15, 33.11, 28.08, 22.15, 21.76, 21.73, 21.65, 21.57, 21.78, 21.87,
-     21.29, 21.64, 21.57, 21.96, 22.72, 25.73, 32.69, 33.11, 24.84, 22.49, 22.35, 21.89, 21.26, 21.72, 21.97, 22.03,
-     20.98, 21.27, 21.41, 21.95, 22.94, 26.33, 32.52, 31.95, 27.46, 25.57, 26.91, 25.86, 22.93, 21.59, 21.84, 21.69,
-     20.65, 21.40, 22.22, 24.45, 25.79, 29.19, 29.33, 27.41, 26.34, 26.63, 26.82, 27.48, 26.44, 23.05, 22.13, 22.41},
-    {20.54, 20.96, 21.24, 20.95, 21.30, 21.45, 21.64, 21.51, 21.34, 21.48, 21.55, 21.51, 21.36, 20.94, 21.15, 21.70,
-     21.33, 21.38, 21.49, 21.57, 21.46, 21.40, 21.81, 21.78, 21.69, 21.68, 21.75, 21.65, 21.46, 21.08, 21.39, 21.51,
-     21.23, 21.47, 21.43, 21.58, 21.86, 21.74, 21.97, 21.69, 22.11, 21.72, 21.65, 21.57, 21.45, 21.53, 21.73, 21.39,
-     22.01, 21.75, 21.43, 21.64, 21.52, 21.85, 21.86, 22.03, 21.89, 21.64, 21.80, 21.82, 21.84, 21.50, 21.47, 21.71,
-     21.53, 21.34, 21.67, 21.88, 21.91, 21.91, 22.30, 22.45, 22.13, 21.97, 22.00, 22.02, 21.67, 21.93, 21.65, 22.01,
-     21.79, 21.73, 21.59, 21.90, 21.85, 22.53, 26.93, 28.96, 23.17, 22.00, 21.90, 22.01, 21.63, 21.45, 21.52, 21.71,
-     21.50, 21.55, 21.68, 21.75, 21.98, 24.61, 31.86, 32.67, 29.31, 22.12, 21.91, 21.58, 21.77, 21.69, 21.63, 22.07,
-     21.13, 21.56, 21.61, 21.76, 22.33, 26.38, 29.87, 32.58, 30.97, 22.29, 21.83, 21.77, 21.48, 21.94, 21.63, 21.42,
-     21.44, 21.72, 21.61, 22.05, 22.33, 27.68, 33.19, 33.26, 29.23, 22.24, 21.44, 22.06, 21.65, 21.46, 22.06, 21.95,
-     21.82, 21.42, 22.10, 21.79, 22.72, 25.50, 32.69, 33.19, 25.66, 22.54, 22.59, 21.78, 21.72, 21.60, 21.68, 22.03,
-     21.74, 21.52, 21.55, 22.02, 23.00, 25.98, 32.61, 32.13, 27.60, 25.61, 26.71, 26.02, 22.81, 21.73, 21.84, 21.69,
-     22.16, 21.12, 22.22, 24.93, 26.10, 29.14, 29.55, 27.46, 26.45, 26.79, 27.22, 27.41, 26.31, 23.43, 21.95, 22.65},
-    {20.08, 21.16, 21.34, 21.32, 21.25, 21.28, 21.82, 21.41, 21.46, 21.49, 21.38, 21.20, 21.24, 21.35, 20.99, 21.30,
-     21.16, 20.99, 21.08, 21.27, 21.65, 21.73, 21.67, 21.69, 21.70, 21.69, 21.60, 21.67, 21.09, 21.02, 21.01, 21.64,
-     21.00, 21.05, 21.57, 21.65, 21.67, 21.65, 21.80, 21.66, 21.76, 21.77, 21.85, 21.79, 21.52, 21.42, 21.60, 21.84,
-     20.97, 21.36, 21.75, 21.87, 21.82, 21.85, 22.04, 22.16, 21.86, 21.61, 21.81, 21.64, 21.64, 21.70, 21.42, 21.74,
-     21.32, 21.55, 21.62, 21.69, 21.83, 21.83, 22.23, 22.38, 22.01, 22.05, 21.75, 21.99, 21.68, 21.54, 21.60, 21.96,
-     21.50, 21.48, 21.77, 21.71, 21.86, 22.41, 27.63, 29.12, 23.26, 22.09, 21.86, 21.97, 21.50, 21.07, 21.67, 21.66,
-     21.15, 21.37, 21.58, 21.41, 21.98, 24.90, 31.94, 32.57, 29.39, 21.76, 21.66, 21.73, 21.43, 21.53, 21.65, 21.57,
-     21.38, 21.31, 21.63, 21.62, 22.29, 26.47, 29.88, 33.15, 31.02, 22.33, 21.84, 21.60, 21.64, 21.60, 21.84, 21.84,
-     21.30, 21.39, 21.69, 22.01, 22.53, 28.15, 33.32, 33.00, 29.74, 22.50, 21.99, 21.83, 21.45, 21.47, 21.46, 21.89,
-     21.14, 21.36, 21.79, 21.86, 22.52, 26.06, 32.83, 33.04, 25.71, 22.36, 22.65, 21.90, 21.62, 21.24, 21.63, 21.72,
-     21.53, 20.97, 21.78, 22.09, 23.18, 25.89, 32.58, 32.01, 27.93, 25.63, 26.92, 26.31, 22.95, 21.89, 21.79, 22.19,
-     20.75, 21.43, 22.24, 24.95, 25.26, 29.09, 29.35, 27.42, 26.36, 26.59, 27.01, 27.49, 26.93, 23.30, 22.07, 22.45},
-    {20.60, 20.80, 21.26, 21.18, 21.44, 21.52, 21.48, 21.35, 21.41, 21.20, 21.38, 21.01, 20.88, 21.20, 21.08, 21.19,
-     21.16, 21.08, 21.29, 21.78, 21.65, 21.46, 21.41, 21.59, 21.75, 21.69, 21.55, 21.38, 21.47, 20.89, 21.17, 21.25,
-     21.00, 21.42, 21.51, 21.59, 21.67, 21.56, 21.71, 21.97, 21.67, 21.73, 21.51, 21.47, 21.35, 21.49, 21.38, 21.16,
-     21.71, 21.50, 21.38, 21.60, 21.67, 21.76, 21.86, 21.82, 22.16, 21.82, 21.63, 21.69, 21.70, 21.52, 21.28, 21.25,
-     21.31, 21.42, 21.57, 21.74, 21.74, 22.18, 22.19, 21.94, 21.89, 21.93, 21.66, 21.61, 21.68, 21.54, 21.53, 21.73,
-     21.43, 21.49, 21.49, 21.76, 22.04, 22.91, 28.54, 28.56, 22.71, 21.97, 21.90, 21.65, 21.64, 21.46, 21.67, 21.73,
-     21.22, 21.56, 21.47, 21.81, 22.25, 25.64, 32.41, 32.64, 28.26, 21.96, 21.71, 21.59, 21.53, 21.64, 21.45, 21.34,
-     21.85, 21.25, 21.27, 21.92, 22.34, 26.76, 31.55, 33.11, 30.64, 22.29, 21.71, 21.64, 21.59, 21.61, 21.58, 21.76,
-     21.38, 21.46, 21.39, 21.85, 22.67, 29.80, 33.48, 32.59, 29.35, 22.29, 21.45, 21.64, 21.66, 21.65, 21.60, 21.81,
-     21.49, 21.37, 21.66, 21.92, 22.68, 27.13, 32.95, 32.75, 25.63, 22.73, 22.41, 21.90, 21.62, 21.80, 21.70, 21.54,
-     21.27, 21.05, 21.78, 21.59, 23.12, 26.35, 32.49, 32.10, 27.98, 25.63, 26.82, 26.31, 23.44, 21.82, 21.63, 21.34,
-     21.99, 21.04, 22.08, 24.94, 25.75, 29.09, 29.35, 27.47, 26.56, 26.59, 26.89, 27.67, 26.46, 23.68, 21.80, 22.08},
-    {19.92, 20.63, 20.79, 21.33, 21.33, 21.23, 21.61, 21.37, 21.42, 21.50, 21.57, 21.21, 21.33, 21.13, 20.91, 21.20,
-     21.07, 21.24, 21.52, 21.47, 21.38, 21.63, 21.42, 21.60, 21.61, 21.29, 21.67, 21.57, 21.36, 20.96, 21.10, 21.36,
-     21.02, 21.21, 21.71, 21.66, 21.78, 21.76, 21.77, 21.76, 21.68, 21.78, 21.52, 21.69, 21.37, 21.30, 21.76, 21.60,
-     21.39, 21.51, 21.70, 21.77, 21.93, 21.86, 21.87, 21.92, 21.82, 21.75, 21.46, 21.75, 21.55, 21.53, 21.43, 21.75,
-     21.48, 21.63, 21.40, 21.75, 21.84, 21.97, 22.32, 22.15, 21.86, 21.82, 21.63, 21.53, 21.54, 21.60, 21.41, 21.51,
-     21.13, 21.69, 21.67, 21.97, 21.97, 23.46, 28.85, 27.08, 22.37, 21.98, 21.87, 21.57, 21.46, 21.03, 21.55, 21.82,
-     21.31, 21.32, 21.71, 21.67, 22.31, 27.30, 32.52, 32.72, 26.64, 21.77, 21.63, 21.69, 21.59, 21.48, 21.46, 21.73,
-     21.47, 21.79, 21.46, 21.94, 22.76, 27.55, 32.08, 33.01, 29.31, 22.02, 21.85, 21.52, 21.60, 21.44, 21.59, 21.53,
-     21.15, 21.40, 21.34, 22.08, 22.83, 30.87, 33.48, 32.60, 27.94, 21.92, 21.87, 21.75, 21.41, 21.36, 21.81, 21.43,
-     21.60, 21.08, 21.73, 22.04, 22.95, 27.73, 33.09, 32.76, 25.25, 22.55, 22.75, 21.86, 21.81, 21.25, 21.79, 21.64,
-     21.16, 21.15, 21.44, 21.98, 23.14, 26.51, 32.40, 31.75, 27.76, 25.44, 26.63, 26.54, 23.15, 21.76, 21.96, 21.73,
-     22.02, 21.25, 22.18, 24.69, 25.76, 28.94, 29.46, 27.22, 26.63, 26.60, 26.79, 27.74, 26.47, 23.76, 22.08, 21.97},
-    {19.92, 20.54, 21.35, 21.05, 21.07, 21.24, 21.27, 21.48, 21.53, 21.50, 21.45, 21.28, 21.04, 21.13, 21.28, 21.42,
-     21.07, 21.17, 21.44, 21.47, 21.60, 21.53, 21.52, 21.40, 21.36, 21.29, 21.56, 21.51, 21.04, 20.90, 21.67, 21.74,
-     20.66, 20.99, 21.20, 21.43, 21.58, 21.52, 21.77, 21.98, 21.82, 21.55, 21.52, 21.64, 21.48, 21.30, 21.39, 21.51,
-     21.63, 21.09, 21.58, 21.72, 21.83, 21.91, 21.83, 22.05, 21.87, 21.66, 21.91, 21.94, 21.44, 21.53, 21.50, 21.83,
-     21.25, 21.17, 21.52, 21.65, 21.93, 22.01, 22.15, 21.99, 21.70, 21.86, 22.02, 21.76, 21.44, 21.38, 21.68, 21.89,
-     21.51, 21.30, 21.67, 21.92, 22.05, 24.45, 28.66, 25.22, 22.06, 21.82, 21.79, 21.66, 21.60, 21.20, 21.55, 21.89,
-     20.93, 21.57, 21.76, 21.82, 22.75, 28.97, 32.52, 32.01, 24.41, 21.77, 21.63, 21.83, 21.64, 21.27, 21.72, 21.35,
-     21.23, 21.52, 21.81, 21.93, 22.67, 28.44, 32.68, 32.86, 27.14, 21.82, 21.72, 21.65, 21.45, 21.39, 21.66, 21.69,
-     21.06, 21.47, 21.64, 21.86, 23.30, 31.80, 33.33, 32.45, 26.46, 21.96, 21.78, 21.55, 21.14, 21.13, 21.68, 21.59,
-     20.97, 21.30, 21.73, 22.04, 22.95, 28.82, 33.30, 32.31, 23.85, 22.46, 22.75, 22.12, 21.40, 21.50, 21.56, 21.72,
-     21.16, 20.98, 21.79, 22.10, 23.42, 26.76, 32.54, 31.66, 27.15, 25.68, 26.88, 26.53, 23.33, 21.56, 21.80, 21.82,
-     19.74, 20.95, 22.72, 24.75, 26.06, 29.10, 29.36, 27.22, 26.42, 26.38, 26.84, 27.62, 26.94, 23.46, 22.17, 21.85},
-    {20.26, 21.34, 21.42, 21.19, 21.45, 21.58, 21.77, 21.59, 21.53, 21.61, 21.39, 21.47, 21.46, 20.97, 20.99, 21.85,
-     21.27, 21.40, 21.58, 21.66, 21.82, 21.57, 21.88, 21.69, 21.86, 21.65, 21.61, 21.62, 21.48, 20.96, 21.83, 21.64,
-     21.18, 21.49, 21.39, 21.65, 21.78, 22.14, 21.58, 21.93, 21.82, 21.82, 21.81, 21.74, 21.53, 21.81, 21.31, 21.68,
-     21.47, 21.50, 21.76, 21.77, 21.78, 22.00, 21.96, 22.04, 21.95, 21.96, 21.87, 21.79, 21.65, 21.76, 21.84, 22.16,
-     21.48, 21.76, 21.51, 22.00, 21.84, 22.09, 22.11, 22.27, 21.82, 21.98, 21.97, 21.95, 21.84, 21.60, 21.74, 21.96,
-     21.74, 21.88, 21.89, 21.97, 22.51, 25.15, 27.37, 23.28, 22.10, 22.01, 21.83, 21.80, 21.60, 21.47, 21.67, 21.82,
-     21.30, 21.76, 21.76, 22.26, 23.28, 30.73, 32.52, 30.57, 22.84, 21.97, 21.92, 21.87, 21.59, 21.87, 21.78, 21.88,
-     22.01, 21.51, 21.87, 22.34, 23.53, 29.57, 32.98, 32.34, 24.85, 21.89, 21.85, 21.93, 21.55, 21.96, 22.05, 21.77,
-     21.30, 21.80, 21.75, 22.39, 24.10, 32.68, 33.40, 31.99, 24.56, 21.96, 21.91, 21.84, 21.72, 21.53, 22.08, 21.74,
-     21.67, 21.66, 22.05, 22.61, 23.61, 30.29, 33.30, 32.02, 23.28, 22.55, 22.84, 22.27, 21.80, 22.00, 21.71, 21.90,
-     21.40, 21.38, 22.06, 22.16, 23.80, 27.50, 32.77, 31.48, 26.87, 25.44, 26.83, 26.53, 23.57, 22.03, 22.04, 21.73,
-     21.73, 21.73, 22.79, 25.15, 26.24, 29.54, 29.67, 27.27, 26.57, 26.70, 26.84, 27.68, 26.87, 24.20, 21.81, 22.95},
-    {20.44, 21.35, 21.27, 21.26, 21.64, 21.59, 21.66, 21.81, 21.75, 21.56, 21.51, 21.41, 21.46, 21.21, 21.55, 21.63,
-     21.78, 21.24, 21.65, 21.85, 21.71, 21.89, 21.88, 21.84, 21.91, 21.80, 21.77, 21.56, 21.48, 21.25, 21.51, 21.35,
-     21.79, 21.57, 21.45, 21.77, 21.93, 22.00, 21.85, 21.84, 21.81, 21.64, 21.91, 21.59, 21.76, 21.62, 21.76, 21.59,
-     21.79, 21.64, 21.76, 21.93, 21.88, 22.04, 22.18, 21.87, 21.95, 21.87, 21.78, 21.89, 22.02, 21.77, 21.64, 21.83,
-     21.63, 21.89, 21.63, 21.85, 22.20, 22.14, 22.23, 21.86, 22.10, 21.81, 21.97, 21.71, 21.89, 21.83, 21.61, 22.04,
-     21.97, 21.82, 22.06, 22.12, 22.73, 25.23, 25.47, 22.26, 21.90, 22.10, 22.00, 21.79, 21.85, 21.64, 21.54, 21.66,
-     21.82, 21.51, 21.70, 22.32, 24.03, 31.77, 32.41, 28.26, 22.10, 21.77, 21.67, 21.64, 21.98, 21.87, 21.66, 21.88,
-     21.62, 21.78, 21.75, 22.34, 24.30, 30.53, 32.98, 31.71, 23.07, 21.77, 21.81, 21.65, 21.70, 22.02, 21.92, 21.84,
-     21.78, 22.01, 21.99, 22.33, 24.85, 32.96, 33.25, 31.76, 23.20, 21.88, 21.64, 21.64, 21.72, 21.77, 21.74, 21.90,
-     21.41, 21.74, 21.99, 22.50, 23.92, 30.96, 33.42, 31.36, 22.83, 22.69, 23.03, 21.96, 21.80, 21.62, 21.86, 21.63,
-     22.28, 21.54, 21.85, 22.41, 23.86, 27.55, 32.72, 31.12, 26.64, 25.92, 26.83, 26.59, 23.45, 22.03, 21.87, 22.01,
-     22.24, 22.23, 22.72, 25.02, 26.67, 29.10, 29.51, 27.00, 26.52, 26.70, 26.73, 27.85, 27.20, 24.13, 22.71, 22.09},
-    {21.32, 21.36, 20.96, 21.41, 21.52, 21.65, 21.72, 21.65, 21.92, 21.62, 21.45, 21.68, 21.68, 21.37, 21.28, 21.31,
-     21.07, 21.73, 21.45, 21.67, 21.55, 21.58, 21.83, 21.85, 21.72, 21.75, 21.72, 21.69, 21.87, 21.32, 21.68, 21.37,
-     21.37, 21.50, 21.59, 21.72, 21.94, 21.91, 21.86, 21.76, 21.78, 21.74, 21.82, 21.70, 21.93, 21.88, 21.54, 21.69,
-     21.80, 21.86, 21.64, 21.94, 22.08, 22.09, 21.96, 21.92, 22.00, 21.88, 21.74, 21.85, 21.87, 21.53, 21.78, 22.41,
-     21.72, 21.77, 21.64, 21.96, 21.89, 22.06, 22.24, 21.87, 22.03, 21.99, 21.72, 21.82, 21.95, 21.55, 21.55, 22.05,
-     21.90, 21.82, 22.24, 22.23, 22.65, 24.87, 24.30, 22.15, 21.99, 22.02, 21.87, 21.76, 21.71, 21.53, 21.68, 21.75,
-     21.54, 21.90, 22.17, 22.42, 24.87, 32.27, 32.13, 26.25, 22.11, 21.86, 21.76, 21.79, 21.89, 21.60, 21.66, 22.34,
-     21.63, 22.05, 22.17, 22.65, 25.43, 30.85, 32.94, 30.58, 22.36, 21.86, 21.77, 21.66, 21.81, 21.91, 21.72, 21.85,
-     21.80, 21.75, 22.18, 22.71, 25.50, 33.08, 33.10, 31.04, 22.40, 21.92, 21.87, 21.70, 21.57, 21.66, 21.75, 21.91,
-     21.96, 22.12, 22.00, 22.85, 24.49, 31.36, 33.26, 30.78, 22.62, 22.47, 22.66, 22.12, 21.52, 21.82, 21.57, 21.82,
-     22.05, 21.96, 22.22, 22.49, 24.09, 28.10, 32.91, 31.21, 26.46, 25.69, 26.68, 26.43, 23.64, 21.83, 21.97, 22.11,
-     22.78, 21.85, 22.81, 25.23, 26.13, 29.71, 29.57, 26.85, 26.53, 26.76, 26.96, 27.56, 27.15, 24.28, 22.45, 22.71},
-    {21.49, 21.27, 21.52, 21.48, 21.39, 21.95, 21.44, 21.37, 21.81, 21.56, 21.40, 21.35, 21.61, 21.30, 21.01, 21.10,
-     21.90, 21.50, 21.52, 21.79, 22.00, 21.90, 21.63, 21.80, 21.71, 21.76, 21.78, 21.45, 21.87, 21.40, 21.68, 21.56,
-     21.63, 21.94, 21.33, 21.61, 21.94, 22.01, 21.82, 21.62, 21.82, 21.88, 21.67, 21.65, 21.65, 21.50, 21.32, 21.86,
-     22.05, 21.93, 21.52, 21.67, 21.98, 22.00, 21.79, 22.01, 21.91, 21.97, 21.74, 21.70, 21.92, 21.71, 21.51, 21.59,
-     21.88, 21.90, 21.70, 21.91, 22.16, 22.36, 22.12, 22.11, 22.03, 21.86, 21.89, 21.86, 22.00, 21.96, 21.55, 21.59,
-     21.83, 21.70, 21.67, 22.03, 22.92, 24.66, 23.19, 21.99, 21.87, 21.98, 21.70, 21.85, 21.71, 21.64, 21.55, 21.82,
-     22.06, 21.71, 22.00, 22.47, 25.69, 32.61, 31.48, 24.31, 21.95, 22.02, 21.72, 21.74, 21.79, 21.82, 21.73, 21.96,
-     21.71, 22.19, 22.11, 22.50, 26.50, 31.37, 32.83, 29.37, 21.95, 21.90, 21.81, 21.52, 21.76, 21.85, 21.40, 21.69,
-     21.96, 21.96, 22.00, 22.61, 26.15, 33.40, 32.98, 30.24, 22.27, 21.88, 21.78, 21.75, 21.68, 21.90, 21.47, 21.59,
-     22.13, 22.05, 22.19, 22.80, 24.64, 31.80, 33.17, 29.98, 22.44, 22.56, 22.66, 21.91, 21.58, 21.69, 21.64, 21.90,
-     22.44, 21.72, 21.80, 22.30, 24.26, 28.40, 32.59, 30.89, 26.22, 26.03, 26.63, 26.38, 23.70, 22.11, 21.80, 21.55,
-     24.01, 22.25, 22.82, 25.23, 26.38, 29.71, 29.52, 26.74, 26.37, 26.81, 26.91, 27.50, 26.81, 24.43, 21.73, 22.22},
-};
-
-static const int thermal_frames_count = sizeof(thermal_frames) / sizeof(thermal_frames[0]);
@@ -11,3 +11,8 @@ unsigned long hal_millis()
 {
     return SDL_GetTicks();
 }
+
+unsigned long hal_micros()
+{
+    return (double)SDL_GetPerformanceCounter() * 1000000 / SDL_GetPerformanceFrequency();
+}
@@ -0,0 +1,523 @@
+#include "mlx90641_emulator.h"
+
+#include "hal_time.h"
+
+#include <MLX90641_API.h>
+#include <MLX90641_I2C_Driver.h>
+#include <mlx90641_synthetic.h>
+
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define SLAVE_ADDRESS 0x33
+
+#define EEPROM_ADDRESS 0x2400
+#define EEPROM_WORDS 832
+#define RAM_ADDRESS 0x0400
+#define RAM_WORDS 0x01C0
+#define AUX_OFFSET 0x0180
+#define STATUS_REGISTER 0x8000
+#define CONTROL_REGISTER 0x800D
+
+#define PIXEL_COUNT 192
+
+// Power-up value of control register: sub-pages enabled, 2 Hz
+#define CONTROL_DEFAULT 0x0101
+
+#define CONTROL_STEP_MODE 0x0002
+#define CONTROL_TRIGGER 0x8000 // Start measurement on general reset
+#define STATUS_NEW_DATA 0x0008
+#define STATUS_START 0x0020 // Start measurement in step mode
+
+// Noise (standard deviation in degrees) of measured temperatures at 4 Hz.
+// Doubles for every 4x increase of the refresh rate.
+#ifndef MLX90641_EMULATOR_NOISE
+#define MLX90641_EMULATOR_NOISE 0.1f
+#endif
+
+static uint16_t eeprom[EEPROM_WORDS];
+static uint16_t ram[RAM_WORDS];
+static uint16_t status;
+static uint16_t control;
+
+// Control register at the start of the measurement in progress, which
+// determines its ADC resolution
+static uint16_t measurement_control;
+
+// Calibration parameters of the EEPROM contents, for generating measurements
+static paramsMLX90641 params;
+
+static int bus_khz = 100;
+static int bus_max_khz = 0;
+
+// Sub-page and end time (in hal_micros()) of the measurement in progress,
+// if any. Only false in step mode, while waiting to be started.
+static int sub_page;
+static unsigned long measurement_end;
+static bool measuring;
+
+static Mlx90641SceneCallback scene_callback = NULL;
+
+// Recording being replayed, if replay_count > 0
+static const Mlx90641RecordingFrame *replay_frames;
+static uint32_t replay_count = 0;
+static uint32_t replay_duration; // One loop, in milliseconds
+static unsigned long replay_start;
+static uint64_t replay_position; // Frames served so far, over all loops
+
+static uint32_t noise_state = 1;
+static Mlx90641EmulatorStats stats;
+
+/**
+ * Uniformly distributed random number in [0, 1).
+ */
+static float uniform_noise()
+{
+    noise_state = noise_state * 1103515245 + 12345;
+    return (noise_state >> 8) / (float)(1 << 24);
+}
+
+/**
+ * Approximately normally distributed random number, with standard deviation 1.
+ */
+static float gaussian_noise()
+{
+    float sum = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        sum += uniform_noise();
+    }
+    // Sum of 4 uniform values has variance 4/12
+    return (sum - 2) * 1.7320508f;
+}
+
+static int refresh_rate()
+{
+    return (control >> 7) & 0x07;
+}
+
+static unsigned long sub_page_time()
+{
+    return 2000000UL >> refresh_rate();
+}
+
+static bool step_mode()
+{
+    return (control & CONTROL_STEP_MODE) != 0;
+}
+
+static void start_measurement()
+{
+    measuring = true;
+    measurement_end = hal_micros() + sub_page_time();
+    measurement_control = control;
+}
+
+/**
+ * Generate RAM contents for a measurement of the scene, by finding the raw
+ * pixel values that MLX90641_CalculateTo() would turn into the scene's
+ * temperatures.
+ */
+static void generate_sub_page(int page)
+{
+    static float uniform[PIXEL_COUNT];
+    uint16_t frame[242];
+    float target[PIXEL_COUNT];
+    float result[PIXEL_COUNT];
+    int32_t low[PIXEL_COUNT];
+    int32_t high[PIXEL_COUNT];
+
+    Mlx90641Scene scene = {uniform, 1, 25, 25};
+    if (scene_callback != NULL)
+    {
+        scene_callback(&scene);
+    }
+    else
+    {
+        for (int i = 0; i < PIXEL_COUNT; i++)
+        {
+            uniform[i] = scene.ta;
+        }
+    }
+
+    // Auxiliary data for the scene's ambient temperature, at 3.3 V. IR and
+    // Vdd values scale with the ADC resolution, relative to the calibration's
+    // resolution: the gain word compensates this for the pixels (so the
+    // bisection below finds scaled values), and the library corrects Vdd.
+    int resolution = (measurement_control >> 10) & 0x03;
+    float scale = (float)(1 << resolution) / (1 << params.resolutionEE);
+    float ptat = 1700;
+    float ptatArt = (scene.ta - 25) * params.KtPTAT + params.vPTAT25;
+    memset(frame, 0, sizeof(frame));
+    frame[192] = (uint16_t)lrintf(ptat * 262144.0f / ptatArt - ptat * params.alphaPTAT);
+    frame[200] = (uint16_t)lrintf(scale * (params.cpOffset + 3));
+    frame[202] = (uint16_t)lrintf(scale * params.gainEE);
+    frame[224] = (uint16_t)ptat;
+    frame[234] = (uint16_t)lrintf(scale * params.vdd25);
+    frame[240] = control;
+    frame[241] = page;
+
+    float noise = MLX90641_EMULATOR_NOISE * sqrtf((1 << refresh_rate()) / 8.0f);
+    for (int i = 0; i < PIXEL_COUNT; i++)
+    {
+        target[i] = scene.temps[i] + noise * gaussian_noise();
+        low[i] = -32768;
+        high[i] = 32766; // 0x7FFF marks invalid data
+    }
+
+    batchMLX90641 batch = {
+        .frameCount = 1,
+        .frameData = frame,
+        .emissivity = &scene.emissivity,
+        .tr = &scene.tr,
+        .taShift = 0,
+        .ta = NULL,
+        .result = result,
+    };
+
+    // Bisection of all pixels in parallel, temperature increases with raw value
+    for (int step = 0; step < 16; step++)
+    {
+        for (int i = 0; i < PIXEL_COUNT; i++)
+        {
+            frame[i] = (uint16_t)(low[i] + (high[i] - low[i]) / 2);
+        }
+        MLX90641_CalculateToBatch(&params, &batch);
+        for (int i = 0; i < PIXEL_COUNT; i++)
+        {
+            int32_t mid = low[i] + (high[i] - low[i]) / 2;
+            if (low[i] >= high[i])
+            {
+                continue;
+            }
+            // NaN (radiation below zero) counts as too low
+            if (result[i] >= target[i])
+            {
+                high[i] = mid;
+            }
+            else
+            {
+                low[i] = mid + 1;
+            }
+        }
+    }
+
+    // Each 64-word block of RAM holds two rows of both sub-pages
+    for (int i = 0; i < PIXEL_COUNT; i++)
+    {
+        ram[0x40 * (i / 32) + 0x20 * page + i % 32] = (uint16_t)low[i];
+    }
+    memcpy(&ram[AUX_OFFSET], &frame[192], 48 * sizeof(uint16_t));
+}
+
+static void serve_recorded_frame(const uint16_t *data)
+{
+    int page = data[241] & 1;
+    for (int i = 0; i < PIXEL_COUNT; i++)
+    {
+        ram[0x40 * (i / 32) + 0x20 * page + i % 32] = data[i];
+    }
+    memcpy(&ram[AUX_OFFSET], &data[192], 48 * sizeof(uint16_t));
+    status = (status & ~0x0009) | STATUS_NEW_DATA | page;
+}
+
+/**
+ * Serve the newest recorded frame whose time has passed.
+ */
+static void replay_update()
+{
+    unsigned long elapsed = hal_millis() - replay_start;
+    uint64_t loops = elapsed / replay_duration;
+    uint32_t time = elapsed % replay_duration;
+
+    uint32_t index = 0;
+    while (index + 1 < replay_count && replay_frames[index + 1].time_ms <= time)
+    {
+        index++;
+    }
+    uint64_t position = loops * replay_count + index + 1;
+    if (position == replay_position)
+    {
+        return;
+    }
+
+    stats.frames += position - replay_position;
+    stats.overwrites += position - replay_position - 1 + ((status & STATUS_NEW_DATA) != 0);
+    replay_position = position;
+    serve_recorded_frame(replay_frames[index].data);
+}
+
+/**
+ * Complete measurements that should have finished by now.
+ */
+static void update()
+{
+    if (replay_count > 0 && !step_mode())
+    {
+        replay_update();
+        return;
+    }
+
+    unsigned long now = hal_micros();
+    if (!measuring || (long)(now - measurement_end) < 0)
+    {
+        return;
+    }
+
+    if (step_mode())
+    {
+        // Single measurement, then wait to be started again. Recordings
+        // are served in order, ignoring their timing.
+        measuring = false;
+        status &= ~STATUS_START;
+        stats.frames++;
+        stats.overwrites += (status & STATUS_NEW_DATA) != 0;
+        if (replay_count > 0)
+        {
+            serve_recorded_frame(replay_frames[replay_position++ % replay_count].data);
+            return;
+        }
+        generate_sub_page(sub_page);
+        status = (status & ~0x0009) | STATUS_NEW_DATA | sub_page;
+        if ((control & 0x0001) != 0)
+        {
+            sub_page ^= 1;
+        }
+        return;
+    }
+
+    // Only the newest measurement is still in RAM, but sub-pages alternate
+    // for every measurement
+    unsigned long missed = (now - measurement_end) / sub_page_time();
+    measurement_end += (missed + 1) * sub_page_time();
+    if ((control & 0x0001) != 0)
+    {
+        sub_page ^= missed & 1;
+    }
+
+    stats.frames += missed + 1;
+    stats.overwrites += missed + ((status & STATUS_NEW_DATA) != 0);
+
+    generate_sub_page(sub_page);
+    status = (status & ~0x0009) | STATUS_NEW_DATA | sub_page;
+
+    if ((control & 0x0001) != 0)
+    {
+        sub_page ^= 1;
+    }
+    measurement_control = control;
+}
+
+/**
+ * Spend the time a transfer of the given number of bytes (including
+ * addresses) takes on the bus.
+ */
+static void transfer(int bytes)
+{
+    // 9 clocks per byte, plus start and stop conditions
+    unsigned long duration = (bytes * 9 + 2) * 1000UL / bus_khz;
+    unsigned long start = hal_micros();
+    while (hal_micros() - start < duration)
+    {
+    }
+
+    stats.transfers++;
+    stats.bytes += bytes;
+    stats.bus_time_us += duration;
+}
+
+/**
+ * Whether the current transaction fails due to the bus limit. At twice the
+ * limit, one in 10 does.
+ */
+static bool bus_error()
+{
+    if (bus_max_khz <= 0 || bus_khz <= bus_max_khz)
+    {
+        return false;
+    }
+    return uniform_noise() < 0.2f * (bus_khz - bus_max_khz) / bus_khz;
+}
+
+static uint16_t read_word(uint16_t address)
+{
+    if (address >= EEPROM_ADDRESS && address < EEPROM_ADDRESS + EEPROM_WORDS)
+    {
+        return eeprom[address - EEPROM_ADDRESS];
+    }
+    if (address >= RAM_ADDRESS && address < RAM_ADDRESS + RAM_WORDS)
+    {
+        return ram[address - RAM_ADDRESS];
+    }
+    if (address == STATUS_REGISTER)
+    {
+        return status;
+    }
+    if (address == CONTROL_REGISTER)
+    {
+        return control;
+    }
+    return 0;
+}
+
+void mlx90641_emulator_init(void)
+{
+    uint16_t ee[EEPROM_WORDS];
+
+    mlx90641_synthetic_eeprom(ee);
+    for (int i = 0; i < EEPROM_WORDS; i++)
+    {
+        eeprom[i] = i < 16 ? ee[i] : mlx90641_synthetic_hamming_encode(ee[i]);
+    }
+    MLX90641_ExtractParameters(ee, &params);
+
+    memset(ram, 0, sizeof(ram));
+    status = 0;
+    control = CONTROL_DEFAULT | params.resolutionEE << 10;
+    measurement_control = control;
+    sub_page = 0;
+    start_measurement();
+    memset(&stats, 0, sizeof(stats));
+    replay_count = 0;
+}
+
+void mlx90641_emulator_replay(const Mlx90641RecordingHeader *header, const Mlx90641RecordingFrame *frames,
+                              uint32_t count)
+{
+    uint16_t ee[EEPROM_WORDS];
+
+    memcpy(eeprom, header->eeprom, sizeof(eeprom));
+
+    // Power-up resolution, without the Hamming code
+    for (int i = 0; i < EEPROM_WORDS; i++)
+    {
+        ee[i] = i < 16 ? eeprom[i] : eeprom[i] & 0x07FF;
+    }
+    MLX90641_ExtractParameters(ee, &params);
+    control = CONTROL_DEFAULT | params.resolutionEE << 10;
+    start_measurement();
+
+    // Loop after the last frame, keeping the average frame interval
+    uint32_t interval = 500;
+    if (count > 1)
+    {
+        interval = (frames[count - 1].time_ms - frames[0].time_ms) / (count - 1);
+    }
+    replay_frames = frames;
+    replay_count = count;
+    replay_duration = frames[count - 1].time_ms + (interval > 0 ? interval : 1);
+    replay_start = hal_millis();
+    replay_position = 0;
+}
+
+void mlx90641_emulator_set_scene_callback(Mlx90641SceneCallback callback)
+{
+    scene_callback = callback;
+}
+
+void mlx90641_emulator_set_bus_limit(int max_khz)
+{
+    bus_max_khz = max_khz;
+}
+
+void mlx90641_emulator_get_stats(Mlx90641EmulatorStats *result)
+{
+    *result = stats;
+}
+
+int MLX90641_I2CGeneralReset(void)
+{
+    transfer(2);
+    if (bus_error())
+    {
+        stats.nacks++;
+        return -1;
+    }
+
+    // Measurements can be started in sync on multiple sensors this way
+    update();
+    if ((control & CONTROL_TRIGGER) != 0)
+    {
+        control &= ~CONTROL_TRIGGER;
+        start_measurement();
+    }
+    return 0;
+}
+
+int MLX90641_I2CRead(uint8_t slaveAddr, uint16_t startAddress, uint16_t nMemAddressRead, uint16_t *data)
+{
+    if (slaveAddr != SLAVE_ADDRESS || bus_error())
+    {
+        transfer(1);
+        stats.nacks++;
+        return -1;
+    }
+
+    update();
+    for (uint16_t i = 0; i < nMemAddressRead; i++)
+    {
+        data[i] = read_word(startAddress + i);
+    }
+    transfer(4 + 2 * nMemAddressRead);
+    return 0;
+}
+
+int MLX90641_I2CWrite(uint8_t slaveAddr, uint16_t writeAddress, uint16_t data)
+{
+    if (slaveAddr != SLAVE_ADDRESS || bus_error())
+    {
+        transfer(1);
+        stats.nacks++;
+        return -1;
+    }
+
+    update();
+    if (writeAddress == STATUS_REGISTER)
+    {
+        // Only overwrite enable (bit 4), start measurement (bit 5, only
+        // in step mode) and clearing new data (bit 3) are writable
+        status = (status & ~0x0018) | (data & 0x0018);
+        if ((data & STATUS_START) != 0 && step_mode() && !measuring)
+        {
+            status |= STATUS_START;
+            start_measurement();
+        }
+    }
+    else if (writeAddress == CONTROL_REGISTER)
+    {
+        int previous_rate = refresh_rate();
+        bool was_step_mode = step_mode();
+        control = data;
+        if (!step_mode() && (was_step_mode || refresh_rate() != previous_rate))
+        {
+            start_measurement();
+        }
+        if (was_step_mode && !step_mode())
+        {
+            // Frames were served out of time in step mode, continue from here
+            replay_start = hal_millis();
+            replay_position = 0;
+        }
+    }
+    else if (writeAddress >= RAM_ADDRESS && writeAddress < RAM_ADDRESS + RAM_WORDS)
+    {
+        ram[writeAddress - RAM_ADDRESS] = data;
+    }
+    transfer(5);
+
+    // Read back, like the device's driver
+    uint16_t dataCheck;
+    MLX90641_I2CRead(slaveAddr, writeAddress, 1, &dataCheck);
+    if (dataCheck != data)
+    {
+        return -2;
+    }
+
+    return 0;
+}
+
+void MLX90641_I2CFreqSet(int kHz)
+{
+    bus_khz = kHz;
+}
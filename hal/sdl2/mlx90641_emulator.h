@@ -0,0 +1,85 @@
+#ifndef MLX90641_EMULATOR_H
+#define MLX90641_EMULATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mlx90641_recording.h"
+
+#include <stdint.h>
+
+/**
+ * Software model of an MLX90641 and its I2C bus, implementing
+ * MLX90641_I2C_Driver.h. Serves synthetic calibration data from its EEPROM,
+ * the status and control registers, and measures a scene into its RAM at the
+ * configured refresh rate, alternating sub-pages like the real sensor (or
+ * replays a recording of a real sensor). In step mode, it measures a single
+ * sub-page whenever started.
+ * Each transfer takes as long as it would on the real bus.
+ */
+
+typedef struct Mlx90641EmulatorStats
+{
+    uint32_t transfers;   // Number of I2C transactions
+    uint32_t bytes;       // Bytes transferred, including addresses
+    uint64_t bus_time_us; // Time spent on transfers
+    uint32_t frames;      // Sub-pages measured
+    uint32_t overwrites;  // Sub-pages measured before previous one was read
+    uint32_t nacks;       // Transactions that failed, see mlx90641_emulator_set_bus_limit()
+} Mlx90641EmulatorStats;
+
+/**
+ * Power up the sensor, i.e. reset registers to EEPROM defaults.
+ */
+void mlx90641_emulator_init(void);
+
+/**
+ * What the sensor is looking at.
+ */
+typedef struct Mlx90641Scene
+{
+    const float *temps; // Object temperature of each pixel, as calculated using emissivity and tr
+    float emissivity;   // Emissivity for which temps are valid
+    float tr;           // Reflected temperature for which temps are valid
+    float ta;           // Sensor's ambient temperature
+} Mlx90641Scene;
+
+typedef void (*Mlx90641SceneCallback)(Mlx90641Scene *scene);
+
+/**
+ * Set function to call for the scene at the start of each measurement. It's
+ * called from the I2C functions, i.e. on whatever thread uses the bus.
+ * Without callback, the sensor sees a uniform scene at its own temperature.
+ */
+void mlx90641_emulator_set_scene_callback(Mlx90641SceneCallback callback);
+
+/**
+ * Replay a recording instead of measuring the scene: serve the recorded
+ * EEPROM, and each recorded frame once its time (relative to this call)
+ * has passed, looping at the end. The sensor's refresh rate setting has no
+ * effect. Stopped by `mlx90641_emulator_init()`.
+ *
+ * @param header Header of the recording, its EEPROM contents are copied
+ * @param frames Recorded frames, must stay valid during replay
+ * @param count Number of frames, at least 1
+ */
+void mlx90641_emulator_replay(const Mlx90641RecordingHeader *header, const Mlx90641RecordingFrame *frames,
+                              uint32_t count);
+
+/**
+ * Model a marginal bus (e.g. long cables): above the given clock,
+ * transactions randomly fail (like a NACK), more often the further the
+ * clock is above it.
+ *
+ * @param max_khz Highest clock that works reliably, 0 for no limit (default)
+ */
+void mlx90641_emulator_set_bus_limit(int max_khz);
+
+void mlx90641_emulator_get_stats(Mlx90641EmulatorStats *stats);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*MLX90641_EMULATOR_H*/
@@ -0,0 +1,232 @@
+#include "mlx90641_platform.h"
+
+#include "hal_print.h"
+#include "hal_thermal.h"
+#include "hal_time.h"
+#include "mlx90641_emulator.h"
+#include "mlx90641_recording.h"
+
+#include <MLX90641_I2C_Driver.h>
+#include <SDL2/SDL.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Recording to replay, relative to the working directory. Can be overridden
+// at runtime using the THERMAL_RECORDING environment variable.
+#ifndef THERMAL_SIM_RECORDING
+#define THERMAL_SIM_RECORDING "recordings/demo.mlxrec"
+#endif
+
+// Highest clock (in kHz) at which the emulated bus works reliably, e.g. set
+// to 400 to model long cables (see mlx90641_emulator_set_bus_limit()).
+// 0 for a perfect bus.
+#ifndef THERMAL_SIM_I2C_MAX_KHZ
+#define THERMAL_SIM_I2C_MAX_KHZ 0
+#endif
+
+static Mlx90641CaptureCallback captureCallback = NULL;
+static unsigned long capturePeriod;
+static SDL_Thread *captureThread = NULL;
+
+// Held by the capture thread while calling captureCallback, and by the main
+// loop while paused.
+static SDL_mutex *busMutex = NULL;
+
+static Mlx90641RecordingHeader recordingHeader;
+static Mlx90641RecordingFrame *recordingFrames = NULL;
+static uint32_t recordingCount = 0;
+
+/**
+ * Load recording into recordingHeader and recordingFrames.
+ * @returns true when successful, false otherwise.
+ */
+static bool load_recording(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        hal_printf("Cannot open recording %s\n", path);
+        return false;
+    }
+
+    bool ok = false;
+    if (fread(&recordingHeader, sizeof(recordingHeader), 1, file) != 1 ||
+        recordingHeader.magic != MLX90641_RECORDING_MAGIC || recordingHeader.version != MLX90641_RECORDING_VERSION ||
+        recordingHeader.eeprom_words != MLX90641_RECORDING_EEPROM_WORDS ||
+        recordingHeader.frame_words != MLX90641_RECORDING_FRAME_WORDS)
+    {
+        hal_printf("Invalid recording header in %s\n", path);
+    }
+    else
+    {
+        long start = ftell(file);
+        fseek(file, 0, SEEK_END);
+        uint32_t count = (ftell(file) - start) / sizeof(Mlx90641RecordingFrame);
+        fseek(file, start, SEEK_SET);
+
+        recordingFrames = malloc(count * sizeof(Mlx90641RecordingFrame));
+        if (count == 0 || recordingFrames == NULL ||
+            fread(recordingFrames, sizeof(Mlx90641RecordingFrame), count, file) != count)
+        {
+            hal_printf("Cannot read frames of recording %s\n", path);
+            free(recordingFrames);
+            recordingFrames = NULL;
+        }
+        else
+        {
+            hal_printf("Replaying %s: %lu frames, %lu s\n", path, (unsigned long)count,
+                       (unsigned long)(recordingFrames[count - 1].time_ms / 1000));
+            recordingCount = count;
+            ok = true;
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+/**
+ * Scene used when there is no recording: a warm spot moving in circles
+ * in front of a room temperature background.
+ */
+static void synthetic_scene(Mlx90641Scene *scene)
+{
+    static float temps[THERMAL_COLS * THERMAL_ROWS];
+
+    float angle = (hal_millis() % 4000) * (float)M_PI / 2000;
+    float spotX = THERMAL_COLS / 2 + 4 * cosf(angle);
+    float spotY = THERMAL_ROWS / 2 + 3 * sinf(angle);
+    for (int y = 0; y < THERMAL_ROWS; y++)
+    {
+        for (int x = 0; x < THERMAL_COLS; x++)
+        {
+            float distance2 = (x - spotX) * (x - spotX) + (y - spotY) * (y - spotY);
+            temps[y * THERMAL_COLS + x] = 21 + 0.1f * y + 12 * expf(-distance2 / 4);
+        }
+    }
+
+    scene->temps = temps;
+    scene->emissivity = 0.95f;
+    scene->tr = 25;
+    scene->ta = 30;
+}
+
+void mlx90641_platform_init(void)
+{
+    static bool loaded = false;
+    if (!loaded)
+    {
+        const char *path = getenv("THERMAL_RECORDING");
+        load_recording(path != NULL ? path : THERMAL_SIM_RECORDING);
+        busMutex = SDL_CreateMutex();
+        loaded = true;
+    }
+
+    mlx90641_emulator_init();
+    if (recordingCount > 0)
+    {
+        mlx90641_emulator_replay(&recordingHeader, recordingFrames, recordingCount);
+    }
+    else
+    {
+        mlx90641_emulator_set_scene_callback(synthetic_scene);
+    }
+    mlx90641_emulator_set_bus_limit(THERMAL_SIM_I2C_MAX_KHZ);
+}
+
+bool mlx90641_platform_probe(uint8_t slave_addr)
+{
+    uint16_t data;
+    return MLX90641_I2CRead(slave_addr, 0x8000, 1, &data) == 0;
+}
+
+/**
+ * Models the capture timer interrupt of the device: calls the capture
+ * callback periodically, independent of the main loop.
+ */
+static int capture_thread(void *data)
+{
+    unsigned long next = hal_micros();
+    while (true)
+    {
+        SDL_LockMutex(busMutex);
+        Mlx90641CaptureCallback capture = captureCallback;
+        if (capture != NULL)
+        {
+            capture();
+        }
+        SDL_UnlockMutex(busMutex);
+
+        // Like the timer, start a call every period, including the time of
+        // the transfer. When a call took longer, the next one follows at once.
+        next += capturePeriod;
+        long remaining = (long)(next - hal_micros());
+        if (remaining > 0)
+        {
+            hal_sleep((remaining + 999) / 1000);
+        }
+        else
+        {
+            next = hal_micros();
+        }
+    }
+    return 0;
+}
+
+void mlx90641_platform_capture_start(Mlx90641CaptureCallback capture, unsigned long period_us)
+{
+    SDL_LockMutex(busMutex);
+    captureCallback = capture;
+    capturePeriod = period_us;
+    SDL_UnlockMutex(busMutex);
+
+    if (captureThread == NULL)
+    {
+        captureThread = SDL_CreateThread(capture_thread, "capture", NULL);
+        if (captureThread == NULL)
+        {
+            hal_printf("Cannot create capture thread: %s\n", SDL_GetError());
+        }
+    }
+}
+
+void mlx90641_platform_capture_stop(void)
+{
+    if (busMutex == NULL)
+    {
+        return;
+    }
+    SDL_LockMutex(busMutex);
+    captureCallback = NULL;
+    SDL_UnlockMutex(busMutex);
+}
+
+void mlx90641_platform_capture_pause(void)
+{
+    SDL_LockMutex(busMutex);
+}
+
+void mlx90641_platform_capture_resume(void)
+{
+    SDL_UnlockMutex(busMutex);
+}
+
+void mlx90641_platform_get_bus_stats(Mlx90641BusStats *stats)
+{
+    Mlx90641EmulatorStats emulatorStats;
+    mlx90641_emulator_get_stats(&emulatorStats);
+    stats->transactions = emulatorStats.transfers;
+    stats->bytes = emulatorStats.bytes;
+    stats->nacks = emulatorStats.nacks;
+}
+
+void mlx90641_platform_print_stats(void)
+{
+    Mlx90641EmulatorStats stats;
+    mlx90641_emulator_get_stats(&stats);
+    hal_printf("I2C: %lu transfers, %lu bytes, %lu ms busy, %lu sub-pages, %lu overwritten\n",
+               (unsigned long)stats.transfers, (unsigned long)stats.bytes,
+               (unsigned long)(stats.bus_time_us / 1000), (unsigned long)stats.frames,
+               (unsigned long)stats.overwrites);
+}
@@ -15,44 +15,88 @@
  *
  */
 #include "MLX90641_I2C_Driver.h"
+#include "mlx90641_platform.h"
 
 #include <Arduino.h>
 #include <Wire.h>
 
+// Only modified by one context at a time: the capture interrupt, or the main
+// loop while capture is paused
+static Mlx90641BusStats busStats;
+
+void mlx90641_platform_get_bus_stats(Mlx90641BusStats *stats)
+{
+    *stats = busStats;
+}
+
 int MLX90641_I2CGeneralReset(void)
 {
     Wire.beginTransmission(0);
     Wire.write(0x06);
+    busStats.transactions++;
+    busStats.bytes += 2;
     if (Wire.endTransmission() != 0)
     {
+        busStats.nacks++;
         return -1;
     }
     return 0;
 }
 
+// Maximum number of words per read transaction: Wire drops received bytes
+// that don't fit its receive buffer (SERIAL_BUFFER_SIZE on SAMD), so larger
+// reads are split into chunks, each with its own address phase. Also,
+// requestFrom() returns the number of bytes read as uint8_t.
+#ifndef MLX90641_I2C_MAX_READ_WORDS
+#if defined(SERIAL_BUFFER_SIZE) && SERIAL_BUFFER_SIZE < 256
+#define MLX90641_I2C_MAX_READ_WORDS ((SERIAL_BUFFER_SIZE - 1) / 2)
+#elif defined(SERIAL_BUFFER_SIZE)
+#define MLX90641_I2C_MAX_READ_WORDS 127
+#else
+#define MLX90641_I2C_MAX_READ_WORDS 16
+#endif
+#endif
+
 int MLX90641_I2CRead(uint8_t slaveAddr, uint16_t startAddress, uint16_t nMemAddressRead, uint16_t *data)
 {
     while (nMemAddressRead > 0)
     {
+        uint16_t chunk = nMemAddressRead;
+        if (chunk > MLX90641_I2C_MAX_READ_WORDS)
+        {
+            chunk = MLX90641_I2C_MAX_READ_WORDS;
+        }
+
         Wire.beginTransmission(slaveAddr);
         Wire.write(highByte(startAddress));
         Wire.write(lowByte(startAddress));
+        busStats.transactions++;
+        busStats.bytes += 3;
         if (Wire.endTransmission(false) != 0)
         {
             // NACK
+            busStats.nacks++;
+            return -1;
+        }
+
+        busStats.transactions++;
+        busStats.bytes += 1 + chunk * 2;
+        if (Wire.requestFrom(slaveAddr, (size_t)(chunk * 2)) != chunk * 2)
+        {
+            busStats.nacks++;
             return -1;
         }
 
-        Wire.requestFrom(slaveAddr, nMemAddressRead * 2);
-        while (Wire.available() >= 2)
+        for (uint16_t i = 0; i < chunk; i++)
         {
             uint8_t msb = Wire.read();
             uint8_t lsb = Wire.read();
             *data = msb << 8 | lsb;
             data++;
-            startAddress++;
-            nMemAddressRead--;
         }
+
+        startAddress += chunk;
+        nMemAddressRead -= chunk;
     }
 
     return 0;
@@ -70,10 +114,13 @@ int MLX90641_I2CWrite(uint8_t slaveAddr, uint16_t writeAddress, uint16_t data)
     Wire.write(lowByte(writeAddress));
     Wire.write(highByte(data));
     Wire.write(lowByte(data));
+    busStats.transactions++;
+    busStats.bytes += 5;
 
     if (Wire.endTransmission() != 0)
     {
         // NACK
+        busStats.nacks++;
         return -1;
     }
 
@@ -11,3 +11,8 @@ unsigned long hal_millis()
 {
     return millis();
 }
+
+unsigned long hal_micros()
+{
+    return micros();
+}
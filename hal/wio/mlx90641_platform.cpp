@@ -0,0 +1,99 @@
+#include "mlx90641_platform.h"
+
+#include <Arduino.h>
+#include <Wire.h>
+
+static Mlx90641CaptureCallback captureCallback = NULL;
+
+void mlx90641_platform_init(void)
+{
+    Wire.begin();
+}
+
+bool mlx90641_platform_probe(uint8_t slave_addr)
+{
+    Wire.beginTransmission(slave_addr);
+    return (Wire.endTransmission() == 0); // Sensor ACK'ed
+}
+
+void TC3_Handler()
+{
+    TC3->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+    captureCallback();
+}
+
+void mlx90641_platform_capture_start(Mlx90641CaptureCallback capture, unsigned long period_us)
+{
+    mlx90641_platform_capture_stop();
+
+    // 16-bit counter at 3 MHz
+    unsigned long ticks = 3 * period_us;
+    if (ticks > 65536)
+    {
+        ticks = 65536;
+    }
+    captureCallback = capture;
+
+    // Clock TC3 from the 48 MHz generator, prescaled to 3 MHz
+    MCLK->APBBMASK.reg |= MCLK_APBBMASK_TC3;
+    GCLK->PCHCTRL[TC3_GCLK_ID].reg = GCLK_PCHCTRL_GEN_GCLK1 | GCLK_PCHCTRL_CHEN;
+    while ((GCLK->PCHCTRL[TC3_GCLK_ID].reg & GCLK_PCHCTRL_CHEN) == 0)
+    {
+    }
+
+    TC3->COUNT16.CTRLA.reg = TC_CTRLA_SWRST;
+    while (TC3->COUNT16.SYNCBUSY.bit.SWRST)
+    {
+    }
+    TC3->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_PRESCALER_DIV16;
+    TC3->COUNT16.WAVE.reg = TC_WAVE_WAVEGEN_MFRQ;
+    TC3->COUNT16.CC[0].reg = ticks - 1;
+    while (TC3->COUNT16.SYNCBUSY.bit.CC0)
+    {
+    }
+    TC3->COUNT16.INTENSET.reg = TC_INTENSET_MC0;
+
+    // Lowest priority, below SysTick (so millis() keeps running during
+    // transfers) and USB.
+    NVIC_SetPriority(TC3_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+    NVIC_ClearPendingIRQ(TC3_IRQn);
+    NVIC_EnableIRQ(TC3_IRQn);
+
+    TC3->COUNT16.CTRLA.bit.ENABLE = 1;
+    while (TC3->COUNT16.SYNCBUSY.bit.ENABLE)
+    {
+    }
+}
+
+void mlx90641_platform_capture_stop(void)
+{
+    if (captureCallback == NULL)
+    {
+        return;
+    }
+
+    NVIC_DisableIRQ(TC3_IRQn);
+    TC3->COUNT16.CTRLA.bit.ENABLE = 0;
+    while (TC3->COUNT16.SYNCBUSY.bit.ENABLE)
+    {
+    }
+    captureCallback = NULL;
+}
+
+void mlx90641_platform_capture_pause(void)
+{
+    NVIC_DisableIRQ(TC3_IRQn);
+}
+
+void mlx90641_platform_capture_resume(void)
+{
+    if (captureCallback != NULL)
+    {
+        NVIC_EnableIRQ(TC3_IRQn);
+    }
+}
+
+void mlx90641_platform_print_stats(void)
+{
+    // Nothing beyond the statistics of hal_thermal.c
+}
@@ -18,6 +18,61 @@
 #include "MLX90641_I2C_Driver.h"
 #include <math.h>
 
+// Set to 1 to perform all per-frame calculations in single precision.
+// Targets with a single-precision-only FPU (e.g. Cortex-M4F) otherwise
+// have to emulate every double operation in software.
+#ifndef MLX90641_SINGLE_PRECISION
+#define MLX90641_SINGLE_PRECISION 0
+#endif
+
+#if MLX90641_SINGLE_PRECISION
+#define MLX_REAL(x) (x##f)
+#define MLX_SQRT sqrtf
+#define MLX_FABS fabsf
+#else
+#define MLX_REAL(x) (x)
+#define MLX_SQRT sqrt
+#define MLX_FABS fabs
+#endif
+
+// Set to 1 to use a table-seeded Newton step instead of two square roots
+// for the fourth roots in the To calculation. Maximum relative error is
+// ~8e-6, i.e. < 0.01 degC for objects up to 600 degC. Off by default, as
+// whether it's faster than sqrtf() depends on the target's FPU.
+#ifndef MLX90641_FAST_FOURTH_ROOT
+#define MLX90641_FAST_FOURTH_ROOT 0
+#endif
+
+#if MLX90641_FAST_FOURTH_ROOT
+#define MLX_ROOT4(x) FastFourthRoot(x)
+#else
+#define MLX_ROOT4(x) MLX_SQRT(MLX_SQRT(x))
+#endif
+
+// Maximum change of the inputs of the scene constants (see
+// CalculateSceneTaTr()) before they are recalculated.
+#ifndef MLX90641_SCENE_TA_TOLERANCE
+#define MLX90641_SCENE_TA_TOLERANCE 0.01f
+#endif
+#ifndef MLX90641_SCENE_TR_TOLERANCE
+#define MLX90641_SCENE_TR_TOLERANCE 0.01f
+#endif
+#ifndef MLX90641_SCENE_EMISSIVITY_TOLERANCE
+#define MLX90641_SCENE_EMISSIVITY_TOLERANCE 0.0001f
+#endif
+
+typedef struct
+{
+    const paramsMLX90641 *params;
+    float ta;
+    float tr;
+    float emissivity;
+    float taTr;
+} sceneCacheMLX90641;
+
+static sceneCacheMLX90641 sceneCache;
+static sceneCacheStatsMLX90641 sceneCacheStats;
+
 void ExtractVDDParameters(uint16_t *eeData, paramsMLX90641 *mlx90641);
 void ExtractPTATParameters(uint16_t *eeData, paramsMLX90641 *mlx90641);
 void ExtractGainParameters(uint16_t *eeData, paramsMLX90641 *mlx90641);
@@ -32,7 +87,19 @@ void ExtractKtaPixelParameters(uint16_t *eeData, paramsMLX90641 *mlx90641);
 void ExtractKvPixelParameters(uint16_t *eeData, paramsMLX90641 *mlx90641);
 void ExtractCPParameters(uint16_t *eeData, paramsMLX90641 *mlx90641);
 int ExtractDeviatingPixels(uint16_t *eeData, paramsMLX90641 *mlx90641);
+void CompileParameters(paramsMLX90641 *mlx90641);
+void CompileFixedParameters(paramsMLX90641 *mlx90641);
+float CalculateTa(uint16_t *frameData, const paramsMLX90641 *params, float vdd);
+float CalculateSceneTaTr(const paramsMLX90641 *params, float ta, float emissivity, float tr);
+float CalculateTaTr(float ta, float emissivity, float tr);
+void CalculateToVector(uint16_t *frameData, const paramsMLX90641 *params, const frameContextMLX90641 *context,
+                       float emissivity, float tr, float *result);
+float FastFourthRoot(float value);
+int64_t FloatToFixed(float value, int fractionBits);
+uint32_t SquareRoot64(uint64_t value);
+int64_t FourthRootQ16(int64_t value);
 int CheckEEPROMValid(uint16_t *eeData);
+int Parity16(uint16_t value);
 int HammingDecode(uint16_t *eeData);
 int ValidateFrameData(uint16_t *frameData);
 int ValidateAuxData(uint16_t *auxData);
@@ -53,127 +120,61 @@ int MLX90641_DumpEE(uint8_t slaveAddr, uint16_t *eeData)
 
 //------------------------------------------------------------------------------
 
+// Parity check masks of the EEPROM words' Hamming code. Check 4 covers the
+// whole word, so syndromes without it (1..15) mean an even number of bit
+// errors, which can't be corrected.
+static const uint16_t hammingChecks[5] = {0x0D5B, 0x166D, 0x278E, 0x47F0, 0xFFFF};
+
+// Bit to flip for each syndrome, 0 when no error (syndrome 0) or the error
+// can't be corrected (syndromes 1..15).
+static const uint16_t hammingCorrection[32] = {
+    0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,
+    0,      0,      0,      0,      0,      0x8000, 0x0800, 0x1000, 0x0001, 0x2000, 0x0002,
+    0x0004, 0x0008, 0x4000, 0x0010, 0x0020, 0x0040, 0x0080, 0x0100, 0x0200, 0x0400,
+};
+
+static eepromStatsMLX90641 eepromStats;
+
+int Parity16(uint16_t value)
+{
+    value ^= value >> 8;
+    value ^= value >> 4;
+    return (0x6996 >> (value & 0x0F)) & 1;
+}
+
 int HammingDecode(uint16_t *eeData)
 {
     int error = 0;
-    int16_t parity[5];
-    int8_t D[16];
-    int16_t check;
+    int syndrome;
     uint16_t data;
-    uint16_t mask;
+
+    eepromStats.corrected = 0;
+    eepromStats.uncorrectable = 0;
 
     for (int addr = 16; addr < 832; addr++)
     {
-        parity[0] = -1;
-        parity[1] = -1;
-        parity[2] = -1;
-        parity[3] = -1;
-        parity[4] = -1;
-
         data = eeData[addr];
 
-        mask = 1;
-        for (int i = 0; i < 16; i++)
+        syndrome = 0;
+        for (int i = 0; i < 5; i++)
         {
-            D[i] = (data & mask) >> i;
-            mask = mask << 1;
+            syndrome |= Parity16(data & hammingChecks[i]) << i;
         }
 
-        parity[0] = D[0] ^ D[1] ^ D[3] ^ D[4] ^ D[6] ^ D[8] ^ D[10] ^ D[11];
-        parity[1] = D[0] ^ D[2] ^ D[3] ^ D[5] ^ D[6] ^ D[9] ^ D[10] ^ D[12];
-        parity[2] = D[1] ^ D[2] ^ D[3] ^ D[7] ^ D[8] ^ D[9] ^ D[10] ^ D[13];
-        parity[3] = D[4] ^ D[5] ^ D[6] ^ D[7] ^ D[8] ^ D[9] ^ D[10] ^ D[14];
-        parity[4] = D[0] ^ D[1] ^ D[2] ^ D[3] ^ D[4] ^ D[5] ^ D[6] ^ D[7] ^ D[8] ^ D[9] ^ D[10] ^ D[11] ^ D[12] ^
-                    D[13] ^ D[14] ^ D[15];
-
-        if ((parity[0] != 0) || (parity[1] != 0) || (parity[2] != 0) || (parity[3] != 0) || (parity[4] != 0))
+        if (syndrome != 0)
         {
-            check = (parity[0] << 0) + (parity[1] << 1) + (parity[2] << 2) + (parity[3] << 3) + (parity[4] << 4);
-
-            if ((check > 15) && (check < 32))
+            if (hammingCorrection[syndrome] != 0)
             {
-                switch (check)
-                {
-                case 16:
-                    D[15] = 1 - D[15];
-                    break;
-
-                case 24:
-                    D[14] = 1 - D[14];
-                    break;
-
-                case 20:
-                    D[13] = 1 - D[13];
-                    break;
-
-                case 18:
-                    D[12] = 1 - D[12];
-                    break;
-
-                case 17:
-                    D[11] = 1 - D[11];
-                    break;
-
-                case 31:
-                    D[10] = 1 - D[10];
-                    break;
-
-                case 30:
-                    D[9] = 1 - D[9];
-                    break;
-
-                case 29:
-                    D[8] = 1 - D[8];
-                    break;
-
-                case 28:
-                    D[7] = 1 - D[7];
-                    break;
-
-                case 27:
-                    D[6] = 1 - D[6];
-                    break;
-
-                case 26:
-                    D[5] = 1 - D[5];
-                    break;
-
-                case 25:
-                    D[4] = 1 - D[4];
-                    break;
-
-                case 23:
-                    D[3] = 1 - D[3];
-                    break;
-
-                case 22:
-                    D[2] = 1 - D[2];
-                    break;
-
-                case 21:
-                    D[1] = 1 - D[1];
-                    break;
-
-                case 19:
-                    D[0] = 1 - D[0];
-                    break;
-                }
-
+                data ^= hammingCorrection[syndrome];
+                eepromStats.corrected++;
                 if (error == 0)
                 {
                     error = -9;
                 }
-
-                data = 0;
-                mask = 1;
-                for (int i = 0; i < 16; i++)
-                {
-                    data = data + D[i] * mask;
-                    mask = mask << 1;
-                }
             }
             else
             {
+                eepromStats.uncorrectable++;
                 error = -10;
             }
         }
@@ -186,6 +187,13 @@ int HammingDecode(uint16_t *eeData)
 
 //------------------------------------------------------------------------------
 
+void MLX90641_GetEEPROMStats(eepromStatsMLX90641 *stats)
+{
+    *stats = eepromStats;
+}
+
+//------------------------------------------------------------------------------
+
 int MLX90641_SynchFrame(uint8_t slaveAddr)
 {
     uint16_t dataReady = 0;
@@ -215,174 +223,223 @@ int MLX90641_SynchFrame(uint8_t slaveAddr)
 
 int MLX90641_TriggerMeasurement(uint8_t slaveAddr)
 {
-    int error = 1;
-    uint16_t ctrlReg;
-
-    error = MLX90641_I2CRead(slaveAddr, 0x800D, 1, &ctrlReg);
-
-    if (error != 0)
-    {
-        return error;
-    }
-
-    ctrlReg |= 0x8000;
-    error = MLX90641_I2CWrite(slaveAddr, 0x800D, ctrlReg);
-
-    if (error != 0)
-    {
-        return error;
-    }
-
-    error = MLX90641_I2CGeneralReset();
+    triggerMLX90641 trigger = {};
+    int result;
 
-    if (error != 0)
+    do
     {
-        return error;
-    }
-
-    error = MLX90641_I2CRead(slaveAddr, 0x800D, 1, &ctrlReg);
+        result = MLX90641_StepTrigger(slaveAddr, &trigger);
+    } while (result == MLX90641_TRIGGER_IN_PROGRESS);
 
-    if (error != 0)
-    {
-        return error;
-    }
-
-    if ((ctrlReg & 0x8000) != 0)
-    {
-        return -11;
-    }
-
-    return 0;
+    return result;
 }
 
 //------------------------------------------------------------------------------
 
-int MLX90641_GetFrameData(uint8_t slaveAddr, uint16_t *frameData)
+enum
 {
-    uint16_t dataReady = 1;
-    uint16_t controlRegister1;
-    uint16_t statusRegister;
-    uint16_t data[48];
-    int error = 1;
-    uint8_t cnt = 0;
-    uint8_t subPage = 0;
+    TRIGGER_READ_CONTROL = 0,
+    TRIGGER_WRITE_CONTROL,
+    TRIGGER_GENERAL_RESET,
+    TRIGGER_VERIFY,
+};
+
+// Performs one I2C transfer of MLX90641_TriggerMeasurement(), so the caller
+// can do other work in between. Returns MLX90641_TRIGGER_IN_PROGRESS until
+// the last transfer, then 0 once the measurement started. On errors, the next
+// call starts over.
+int MLX90641_StepTrigger(uint8_t slaveAddr, triggerMLX90641 *trigger)
+{
+    uint16_t ctrlReg;
+    int error;
 
-    dataReady = 0;
-    while (dataReady == 0)
+    switch (trigger->state)
     {
-        error = MLX90641_I2CRead(slaveAddr, 0x8000, 1, &statusRegister);
+    case TRIGGER_READ_CONTROL:
+        error = MLX90641_I2CRead(slaveAddr, 0x800D, 1, &trigger->controlRegister);
         if (error != 0)
         {
             return error;
         }
-        dataReady = statusRegister & 0x0008;
-    }
-    subPage = statusRegister & 0x0001;
+        trigger->state = TRIGGER_WRITE_CONTROL;
+        return MLX90641_TRIGGER_IN_PROGRESS;
 
-    error = MLX90641_I2CWrite(slaveAddr, 0x8000, 0x0030);
-    if (error == -1)
-    {
-        return error;
-    }
-
-    if (subPage == 0)
-    {
-        error = MLX90641_I2CRead(slaveAddr, 0x0400, 32, frameData);
-        if (error != 0)
-        {
-            return error;
-        }
-        error = MLX90641_I2CRead(slaveAddr, 0x0440, 32, frameData + 32);
-        if (error != 0)
-        {
-            return error;
-        }
-        error = MLX90641_I2CRead(slaveAddr, 0x0480, 32, frameData + 64);
+    case TRIGGER_WRITE_CONTROL:
+        error = MLX90641_I2CWrite(slaveAddr, 0x800D, trigger->controlRegister | 0x8000);
         if (error != 0)
         {
+            trigger->state = TRIGGER_READ_CONTROL;
             return error;
         }
-        error = MLX90641_I2CRead(slaveAddr, 0x04C0, 32, frameData + 96);
+        trigger->state = TRIGGER_GENERAL_RESET;
+        return MLX90641_TRIGGER_IN_PROGRESS;
+
+    case TRIGGER_GENERAL_RESET:
+        // Addressed to all devices on the bus
+        error = MLX90641_I2CGeneralReset();
         if (error != 0)
         {
+            trigger->state = TRIGGER_READ_CONTROL;
             return error;
         }
-        error = MLX90641_I2CRead(slaveAddr, 0x0500, 32, frameData + 128);
+        trigger->state = TRIGGER_VERIFY;
+        return MLX90641_TRIGGER_IN_PROGRESS;
+
+    case TRIGGER_VERIFY:
+    default:
+        trigger->state = TRIGGER_READ_CONTROL;
+        error = MLX90641_I2CRead(slaveAddr, 0x800D, 1, &ctrlReg);
         if (error != 0)
         {
             return error;
         }
-        error = MLX90641_I2CRead(slaveAddr, 0x0540, 32, frameData + 160);
-        if (error != 0)
+        if ((ctrlReg & 0x8000) != 0)
         {
-            return error;
+            return -11;
         }
+        return 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+int MLX90641_GetFrameData(uint8_t slaveAddr, uint16_t *frameData)
+{
+    frameReaderMLX90641 reader = {};
+    int result;
+
+    do
+    {
+        result = MLX90641_StepFrameData(slaveAddr, &reader, frameData);
+    } while (result == MLX90641_FRAME_NOT_READY || result == MLX90641_FRAME_IN_PROGRESS);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+enum
+{
+    FRAME_READ_STATUS = 0,
+    FRAME_READ_CLEAR,
+    FRAME_READ_PIXELS,
+    FRAME_READ_AUX,
+    FRAME_READ_CONTROL,
+};
+
+// Handles a failed transfer of the frame being read: the next call retries it
+// (up to MLX90641_FRAME_RETRIES times, the sub-page stays in RAM until it's
+// measured again) or restarts with the next frame.
+static int RetryFrameRead(frameReaderMLX90641 *reader, int error)
+{
+    if (reader->retries < MLX90641_FRAME_RETRIES)
+    {
+        reader->retries++;
     }
     else
     {
-        error = MLX90641_I2CRead(slaveAddr, 0x0420, 32, frameData);
+        reader->state = FRAME_READ_STATUS;
+    }
+    return error;
+}
+
+// Performs one I2C transfer of reading a frame, so the caller can do other
+// work in between. Returns MLX90641_FRAME_NOT_READY when no new data is
+// available yet, MLX90641_FRAME_IN_PROGRESS while reading, and the sub-page
+// number once frameData is complete. On errors, the next call retries the
+// failed transfer (reader->state is non-zero) or restarts (state is zero).
+int MLX90641_StepFrameData(uint8_t slaveAddr, frameReaderMLX90641 *reader, uint16_t *frameData)
+{
+    uint16_t statusRegister;
+    uint16_t controlRegister1;
+    uint16_t address;
+    uint16_t length;
+    int error;
+
+    switch (reader->state)
+    {
+    case FRAME_READ_STATUS:
+        error = MLX90641_I2CRead(slaveAddr, 0x8000, 1, &statusRegister);
         if (error != 0)
         {
             return error;
         }
-        error = MLX90641_I2CRead(slaveAddr, 0x0460, 32, frameData + 32);
-        if (error != 0)
+        if ((statusRegister & 0x0008) == 0)
         {
-            return error;
+            return MLX90641_FRAME_NOT_READY;
         }
-        error = MLX90641_I2CRead(slaveAddr, 0x04A0, 32, frameData + 64);
-        if (error != 0)
+        reader->subPage = statusRegister & 0x0001;
+        reader->retries = 0;
+        reader->state = FRAME_READ_CLEAR;
+        return MLX90641_FRAME_IN_PROGRESS;
+
+    case FRAME_READ_CLEAR:
+        // Only clear the new data flag: setting bit 5 (like MLX90641_SynchFrame()
+        // does) would start another measurement in step mode
+        error = MLX90641_I2CWrite(slaveAddr, 0x8000, 0x0010);
+        if (error == -1)
         {
+            reader->state = FRAME_READ_STATUS;
             return error;
         }
-        error = MLX90641_I2CRead(slaveAddr, 0x04E0, 32, frameData + 96);
+        reader->block = 0;
+        reader->state = FRAME_READ_PIXELS;
+        return MLX90641_FRAME_IN_PROGRESS;
+
+    case FRAME_READ_PIXELS:
+        // Each 32-word block holds two rows of the sub-page. The last block
+        // of sub-page 1 is directly followed by the aux data (0x0580), just
+        // like in frameData, so read them in one go.
+        address = 0x0400 + 0x40 * reader->block + 0x20 * reader->subPage;
+        length = (reader->block == 5 && reader->subPage == 1) ? 32 + 48 : 32;
+        error = MLX90641_I2CRead(slaveAddr, address, length, frameData + 32 * reader->block);
         if (error != 0)
         {
-            return error;
+            return RetryFrameRead(reader, error);
         }
-        error = MLX90641_I2CRead(slaveAddr, 0x0520, 32, frameData + 128);
-        if (error != 0)
+        reader->block++;
+        if (reader->block == 6)
         {
-            return error;
+            reader->state = length > 32 ? FRAME_READ_CONTROL : FRAME_READ_AUX;
         }
-        error = MLX90641_I2CRead(slaveAddr, 0x0560, 32, frameData + 160);
+        return MLX90641_FRAME_IN_PROGRESS;
+
+    case FRAME_READ_AUX:
+        error = MLX90641_I2CRead(slaveAddr, 0x0580, 48, frameData + 192);
         if (error != 0)
         {
-            return error;
+            return RetryFrameRead(reader, error);
         }
-    }
+        reader->state = FRAME_READ_CONTROL;
+        return MLX90641_FRAME_IN_PROGRESS;
 
-    error = MLX90641_I2CRead(slaveAddr, 0x0580, 48, data);
-    if (error != 0)
-    {
-        return error;
-    }
+    case FRAME_READ_CONTROL:
+    default:
+        error = MLX90641_I2CRead(slaveAddr, 0x800D, 1, &controlRegister1);
+        frameData[240] = controlRegister1;
+        frameData[241] = reader->subPage;
 
-    error = MLX90641_I2CRead(slaveAddr, 0x800D, 1, &controlRegister1);
-    frameData[240] = controlRegister1;
-    frameData[241] = subPage;
-
-    if (error != 0)
-    {
-        return error;
-    }
+        if (error != 0)
+        {
+            return RetryFrameRead(reader, error);
+        }
 
-    error = ValidateAuxData(data);
-    if (error == 0)
-    {
-        for (cnt = 0; cnt < 48; cnt++)
+        error = ValidateAuxData(frameData + 192);
+        if (error == 0)
         {
-            frameData[cnt + 192] = data[cnt];
+            error = ValidateFrameData(frameData);
+        }
+        if (error != 0)
+        {
+            // Data may have been corrupted on the bus, so read all of it again
+            reader->block = 0;
+            reader->state = FRAME_READ_PIXELS;
+            return RetryFrameRead(reader, error);
         }
-    }
 
-    error = ValidateFrameData(frameData);
-    if (error != 0)
-    {
-        return error;
+        reader->state = FRAME_READ_STATUS;
+        return frameData[241];
     }
-
-    return frameData[241];
 }
 
 int ValidateFrameData(uint16_t *frameData)
@@ -454,6 +511,11 @@ int MLX90641_ExtractParameters(uint16_t *eeData, paramsMLX90641 *mlx90641)
         ExtractKtaPixelParameters(eeData, mlx90641);
         ExtractKvPixelParameters(eeData, mlx90641);
         error = ExtractDeviatingPixels(eeData, mlx90641);
+        CompileParameters(mlx90641);
+        MLX90641_BuildBadPixelTable(mlx90641->brokenPixels, &mlx90641->badPixelTable);
+
+        // Parameters may have been re-extracted in-place
+        sceneCache.params = NULL;
     }
 
     return error;
@@ -538,12 +600,11 @@ int MLX90641_GetRefreshRate(uint8_t slaveAddr)
 
 //------------------------------------------------------------------------------
 
-void MLX90641_CalculateTo(uint16_t *frameData, const paramsMLX90641 *params, float emissivity, float tr, float *result)
+void MLX90641_CalculateTo(uint16_t *frameData, const paramsMLX90641 *params, const frameContextMLX90641 *context,
+                          float emissivity, float tr, float *result)
 {
     float vdd;
     float ta;
-    float ta4;
-    float tr4;
     float taTr;
     float gain;
     float irDataCP;
@@ -551,58 +612,25 @@ void MLX90641_CalculateTo(uint16_t *frameData, const paramsMLX90641 *params, flo
     float alphaCompensated;
     float Sx;
     float To;
-    float alphaCorrR[8];
+    const float *alphaCorrR;
     int8_t range;
     uint16_t subPage;
-    float ktaScale;
-    float kvScale;
-    float alphaScale;
-    float kta;
-    float kv;
+    float taDelta;
+    float alphaTaCorrection;
+    const compiledMLX90641 *compiled = &params->compiled;
 
-    subPage = frameData[241];
-    vdd = MLX90641_GetVdd(frameData, params);
-    ta = MLX90641_GetTa(frameData, params);
-    ta4 = (ta + 273.15);
-    ta4 = ta4 * ta4;
-    ta4 = ta4 * ta4;
-    tr4 = (tr + 273.15);
-    tr4 = tr4 * tr4;
-    tr4 = tr4 * tr4;
-
-    taTr = tr4 - (tr4 - ta4) / emissivity;
-
-    ktaScale = pow(2, (double)params->ktaScale);
-    kvScale = pow(2, (double)params->kvScale);
-    alphaScale = pow(2, (double)params->alphaScale);
-
-    alphaCorrR[1] = 1 / (1 + params->ksTo[1] * 20);
-    alphaCorrR[0] = alphaCorrR[1] / (1 + params->ksTo[0] * 20);
-    alphaCorrR[2] = 1;
-    alphaCorrR[3] = (1 + params->ksTo[2] * params->ct[3]);
-    alphaCorrR[4] = alphaCorrR[3] * (1 + params->ksTo[3] * (params->ct[4] - params->ct[3]));
-    alphaCorrR[5] = alphaCorrR[4] * (1 + params->ksTo[4] * (params->ct[5] - params->ct[4]));
-    alphaCorrR[6] = alphaCorrR[5] * (1 + params->ksTo[5] * (params->ct[6] - params->ct[5]));
-    alphaCorrR[7] = alphaCorrR[6] * (1 + params->ksTo[6] * (params->ct[7] - params->ct[6]));
-
-    //------------------------- Gain calculation -----------------------------------
-    gain = frameData[202];
-    if (gain > 32767)
-    {
-        gain = gain - 65536;
-    }
+    subPage = context->subPage;
+    vdd = context->vdd;
+    ta = context->ta;
+    gain = context->gain;
+    irDataCP = context->irDataCP;
 
-    gain = params->gainEE / gain;
+    taTr = CalculateSceneTaTr(params, ta, emissivity, tr);
+    alphaCorrR = compiled->alphaCorrR;
 
     //------------------------- To calculation -------------------------------------
-    irDataCP = frameData[200];
-    if (irDataCP > 32767)
-    {
-        irDataCP = irDataCP - 65536;
-    }
-    irDataCP = irDataCP * gain;
-
-    irDataCP = irDataCP - params->cpOffset * (1 + params->cpKta * (ta - 25)) * (1 + params->cpKv * (vdd - 3.3));
+    taDelta = ta - 25;
+    alphaTaCorrection = 1 + params->KsTa * (ta - 25);
 
     for (int pixelNumber = 0; pixelNumber < 192; pixelNumber++)
     {
@@ -613,101 +641,458 @@ void MLX90641_CalculateTo(uint16_t *frameData, const paramsMLX90641 *params, flo
         }
         irData = irData * gain;
 
-        kta = (float)params->kta[pixelNumber] / ktaScale;
-        kv = (float)params->kv[pixelNumber] / kvScale;
-
-        irData = irData - params->offset[subPage][pixelNumber] * (1 + kta * (ta - 25)) * (1 + kv * (vdd - 3.3));
+        irData = irData - compiled->offset[subPage][pixelNumber] * (1 + compiled->kta[pixelNumber] * taDelta) *
+                              (1 + compiled->kv[pixelNumber] * (vdd - MLX_REAL(3.3)));
 
         irData = irData - params->tgc * irDataCP;
 
         irData = irData / emissivity;
 
-        alphaCompensated = SCALEALPHA * alphaScale / params->alpha[pixelNumber];
-        alphaCompensated = alphaCompensated * (1 + params->KsTa * (ta - 25));
+        alphaCompensated = compiled->alpha[pixelNumber] * alphaTaCorrection;
 
         Sx = alphaCompensated * alphaCompensated * alphaCompensated * (irData + alphaCompensated * taTr);
-        Sx = sqrt(sqrt(Sx)) * params->ksTo[2];
+        Sx = MLX_ROOT4(Sx) * params->ksTo[2];
 
-        To = sqrt(sqrt(irData / (alphaCompensated * (1 - params->ksTo[2] * 273.15) + Sx) + taTr)) - 273.15;
+        To = MLX_ROOT4(irData / (alphaCompensated * (1 - params->ksTo[2] * MLX_REAL(273.15)) + Sx) + taTr) -
+             MLX_REAL(273.15);
 
-        if (To < params->ct[1])
-        {
-            range = 0;
-        }
-        else if (To < params->ct[2])
-        {
-            range = 1;
-        }
-        else if (To < params->ct[3])
-        {
-            range = 2;
-        }
-        else if (To < params->ct[4])
+        // ct[] is ascending, so the range is the number of breakpoints at or below To
+        range = 0;
+        for (int i = 1; i < 8; i++)
         {
-            range = 3;
+            range += (To >= compiled->ct[i]);
         }
-        else if (To < params->ct[5])
+
+        To = MLX_ROOT4(irData / (alphaCompensated * alphaCorrR[range] *
+                                 (1 + params->ksTo[range] * (To - compiled->ct[range]))) +
+                       taTr) -
+             MLX_REAL(273.15);
+
+        result[pixelNumber] = To;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+float CalculateSceneTaTr(const paramsMLX90641 *params, float ta, float emissivity, float tr)
+{
+    float taTr;
+
+    // Emissivity and reflected temperature hardly ever change, and Ta
+    // only drifts slowly, so most frames can reuse the previous result.
+    if (sceneCache.params == params && MLX_FABS(ta - sceneCache.ta) <= MLX90641_SCENE_TA_TOLERANCE &&
+        MLX_FABS(tr - sceneCache.tr) <= MLX90641_SCENE_TR_TOLERANCE &&
+        MLX_FABS(emissivity - sceneCache.emissivity) <= MLX90641_SCENE_EMISSIVITY_TOLERANCE)
+    {
+        sceneCacheStats.hits++;
+        return sceneCache.taTr;
+    }
+
+    taTr = CalculateTaTr(ta, emissivity, tr);
+
+    sceneCache.params = params;
+    sceneCache.ta = ta;
+    sceneCache.tr = tr;
+    sceneCache.emissivity = emissivity;
+    sceneCache.taTr = taTr;
+    sceneCacheStats.misses++;
+
+    return taTr;
+}
+
+//------------------------------------------------------------------------------
+
+float CalculateTaTr(float ta, float emissivity, float tr)
+{
+    float ta4;
+    float tr4;
+
+    ta4 = (ta + MLX_REAL(273.15));
+    ta4 = ta4 * ta4;
+    ta4 = ta4 * ta4;
+    tr4 = (tr + MLX_REAL(273.15));
+    tr4 = tr4 * tr4;
+    tr4 = tr4 * tr4;
+
+    return tr4 - (tr4 - ta4) / emissivity;
+}
+
+//------------------------------------------------------------------------------
+
+// Calculates To for a batch of recorded frames, e.g. for offline
+// reprocessing on a PC. Frames are independent, so when built with OpenMP
+// (-fopenmp) they are spread over all cores. The per-frame kernel is
+// written to be auto-vectorized (build with -O3 -fno-math-errno).
+void MLX90641_CalculateToBatch(const paramsMLX90641 *params, const batchMLX90641 *batch)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int frame = 0; frame < batch->frameCount; frame++)
+    {
+        uint16_t *frameData = batch->frameData + 242 * frame;
+        frameContextMLX90641 context;
+        float tr;
+
+        MLX90641_GetFrameContext(frameData, params, &context);
+        if (batch->ta != NULL)
         {
-            range = 4;
+            batch->ta[frame] = context.ta;
         }
-        else if (To < params->ct[6])
+
+        tr = batch->tr != NULL ? batch->tr[frame] : context.ta - batch->taShift;
+        CalculateToVector(frameData, params, &context, batch->emissivity[frame], tr, batch->result + 192 * frame);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+// Single-precision equivalent of MLX90641_CalculateTo() without
+// data-dependent branches or table lookups, so the compiler can vectorize
+// the pixel loop. Doesn't use the scene cache, which isn't thread-safe.
+void CalculateToVector(uint16_t *frameData, const paramsMLX90641 *params, const frameContextMLX90641 *context,
+                       float emissivity, float tr, float *result)
+{
+    const compiledMLX90641 *compiled = &params->compiled;
+    const float *offset = compiled->offset[context->subPage];
+    float alphaCorrR[8];
+    float ksTo[8];
+    float ct[8];
+    float taTr;
+    float gain;
+    float taDelta;
+    float vddDelta;
+    float irDataCP;
+    float alphaTaCorrection;
+    float ksTo2Correction;
+
+    for (int i = 0; i < 8; i++)
+    {
+        alphaCorrR[i] = compiled->alphaCorrR[i];
+        ksTo[i] = params->ksTo[i];
+        ct[i] = compiled->ct[i];
+    }
+
+    taTr = CalculateTaTr(context->ta, emissivity, tr);
+    gain = context->gain;
+    taDelta = context->ta - 25;
+    vddDelta = context->vdd - 3.3f;
+    irDataCP = params->tgc * context->irDataCP;
+    alphaTaCorrection = 1 + params->KsTa * taDelta;
+    ksTo2Correction = 1 - ksTo[2] * 273.15f;
+
+    for (int pixelNumber = 0; pixelNumber < 192; pixelNumber++)
+    {
+        float irData;
+        float alphaCompensated;
+        float Sx;
+        float To;
+        float rangeAlphaCorrR;
+        float rangeKsTo;
+        float rangeCt;
+
+        irData = (int16_t)frameData[pixelNumber] * gain;
+        irData = irData - offset[pixelNumber] * (1 + compiled->kta[pixelNumber] * taDelta) *
+                              (1 + compiled->kv[pixelNumber] * vddDelta);
+        irData = (irData - irDataCP) / emissivity;
+
+        alphaCompensated = compiled->alpha[pixelNumber] * alphaTaCorrection;
+
+        Sx = alphaCompensated * alphaCompensated * alphaCompensated * (irData + alphaCompensated * taTr);
+        Sx = sqrtf(sqrtf(Sx)) * ksTo[2];
+
+        To = sqrtf(sqrtf(irData / (alphaCompensated * ksTo2Correction + Sx) + taTr)) - 273.15f;
+
+        // Select the range's constants rather than indexing by range
+        rangeAlphaCorrR = alphaCorrR[0];
+        rangeKsTo = ksTo[0];
+        rangeCt = ct[0];
+        for (int i = 1; i < 8; i++)
         {
-            range = 5;
+            rangeAlphaCorrR = To >= ct[i] ? alphaCorrR[i] : rangeAlphaCorrR;
+            rangeKsTo = To >= ct[i] ? ksTo[i] : rangeKsTo;
+            rangeCt = To >= ct[i] ? ct[i] : rangeCt;
         }
-        else if (To < params->ct[7])
+
+        To = sqrtf(sqrtf(irData / (alphaCompensated * rangeAlphaCorrR * (1 + rangeKsTo * (To - rangeCt))) + taTr)) -
+             273.15f;
+
+        result[pixelNumber] = To;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+// Fixed-point variant of MLX90641_CalculateTo().
+//
+// Uses the fact that Sx / alphaCompensated == ksTo[2] * (S + taTr)^(1/4), with
+// S = irData / alphaCompensated, to express both solves in terms of S (in K^4).
+// The per-pixel work is integer-only and doesn't need an FPU. The per-frame
+// constants are still converted from the (float) frame context, so results
+// can differ in the last bits between platforms.
+//
+// Fixed-point formats: irData in Q12 counts, 1/alpha in Q8, correction
+// factors in Q20, ksTo in Q30 and temperatures in Q16 Kelvin.
+#define K273_15_Q16 17901158 // 273.15 * 2^16
+
+void MLX90641_CalculateToFixed(uint16_t *frameData, const paramsMLX90641 *params,
+                               const frameContextMLX90641 *context, float emissivity, float tr, float *result)
+{
+    const fixedMLX90641 *fixed = &params->fixed;
+    const int16_t *offset = params->offset[context->subPage];
+    int16_t gainRaw;
+    int32_t gain;
+    int32_t taDelta;
+    int32_t vddDelta;
+    int64_t irDataCP;
+    int64_t frameScale;
+    int64_t taTr;
+    int64_t irData;
+    int64_t S;
+    int64_t To;
+    int64_t correction;
+    int32_t kta;
+    int32_t kv;
+    int range;
+
+    // Per-frame values, converted once from the (float) frame context
+    gainRaw = (int16_t)frameData[202];
+    if (gainRaw == 0)
+    {
+        // Corrupted frame: the float path yields inf, integer division traps
+        for (int pixelNumber = 0; pixelNumber < 192; pixelNumber++)
         {
-            range = 6;
+            result[pixelNumber] = NAN;
         }
-        else
+        return;
+    }
+    gain = ((int32_t)params->gainEE * 65536) / gainRaw;
+    taDelta = FloatToFixed(context->ta - 25, 16);
+    vddDelta = FloatToFixed(context->vdd - MLX_REAL(3.3), 16);
+    irDataCP = FloatToFixed(params->tgc * context->irDataCP, 12);
+    frameScale = FloatToFixed(1 / (emissivity * (1 + params->KsTa * (context->ta - 25))), 20);
+    taTr = FloatToFixed(CalculateTaTr(context->ta, emissivity, tr), 0);
+
+    for (int pixelNumber = 0; pixelNumber < 192; pixelNumber++)
+    {
+        kta = 65536 + ((params->kta[pixelNumber] * taDelta) >> params->ktaScale);
+        kv = 65536 + ((params->kv[pixelNumber] * vddDelta) >> params->kvScale);
+
+        irData = ((int64_t)(int16_t)frameData[pixelNumber] * gain) >> 4;
+        irData = irData - (((int64_t)offset[pixelNumber] * kta * kv) >> 20);
+        irData = irData - irDataCP;
+
+        // S = irData / (emissivity * alphaCompensated), in K^4
+        S = (irData * fixed->alphaInv[pixelNumber]) >> 20;
+        S = (S * frameScale) >> 20;
+
+        To = FourthRootQ16(S + taTr);
+        correction = (1 << 20) + ((fixed->ksTo[2] * (To - K273_15_Q16)) >> 26);
+        To = FourthRootQ16(S * (1 << 20) / correction + taTr) - K273_15_Q16;
+
+        range = 0;
+        for (int i = 1; i < 8; i++)
         {
-            range = 7;
+            range += (To >= (int64_t)params->ct[i] * 65536);
         }
 
-        To = sqrt(sqrt(irData / (alphaCompensated * alphaCorrR[range] *
-                                 (1 + params->ksTo[range] * (To - params->ct[range]))) +
-                       taTr)) -
-             273.15;
+        correction = (1 << 20) + ((fixed->ksTo[range] * (To - (int64_t)params->ct[range] * 65536)) >> 26);
+        correction = (correction * fixed->alphaCorrR[range]) >> 20;
+        To = FourthRootQ16(S * (1 << 20) / correction + taTr) - K273_15_Q16;
 
-        result[pixelNumber] = To;
+        result[pixelNumber] = To / MLX_REAL(65536.0);
     }
 }
 
 //------------------------------------------------------------------------------
 
-void MLX90641_GetImage(uint16_t *frameData, const paramsMLX90641 *params, float *result)
+// Inverse fourth roots of (2^r * (1 + (m + 0.5) / 128)), indexed by [r * 128 + m]
+static const float inverseFourthRootSeed[512] = {
+    0.99902582f, 0.99709159f, 0.99517596f, 0.99327856f, 0.99139911f, 0.98953730f, 0.98769289f, 0.98586547f,
+    0.98405492f, 0.98226082f, 0.98048294f, 0.97872108f, 0.97697490f, 0.97524422f, 0.97352874f, 0.97182822f,
+    0.97014248f, 0.96847129f, 0.96681434f, 0.96517152f, 0.96354252f, 0.96192718f, 0.96032530f, 0.95873666f,
+    0.95716107f, 0.95559835f, 0.95404834f, 0.95251077f, 0.95098555f, 0.94947243f, 0.94797128f, 0.94648194f,
+    0.94500417f, 0.94353795f, 0.94208294f, 0.94063914f, 0.93920636f, 0.93778437f, 0.93637311f, 0.93497241f,
+    0.93358213f, 0.93220210f, 0.93083221f, 0.92947233f, 0.92812234f, 0.92678207f, 0.92545146f, 0.92413032f,
+    0.92281854f, 0.92151606f, 0.92022270f, 0.91893834f, 0.91766292f, 0.91639632f, 0.91513836f, 0.91388905f,
+    0.91264820f, 0.91141570f, 0.91019154f, 0.90897548f, 0.90776753f, 0.90656757f, 0.90537554f, 0.90419126f,
+    0.90301466f, 0.90184569f, 0.90068430f, 0.89953029f, 0.89838368f, 0.89724433f, 0.89611214f, 0.89498711f,
+    0.89386904f, 0.89275795f, 0.89165372f, 0.89055634f, 0.88946563f, 0.88838154f, 0.88730407f, 0.88623309f,
+    0.88516855f, 0.88411039f, 0.88305849f, 0.88201284f, 0.88097334f, 0.87993991f, 0.87891257f, 0.87789118f,
+    0.87687564f, 0.87586600f, 0.87486213f, 0.87386405f, 0.87287158f, 0.87188470f, 0.87090343f, 0.86992759f,
+    0.86895722f, 0.86799228f, 0.86703265f, 0.86607826f, 0.86512911f, 0.86418521f, 0.86324638f, 0.86231261f,
+    0.86138391f, 0.86046016f, 0.85954136f, 0.85862744f, 0.85771835f, 0.85681409f, 0.85591453f, 0.85501969f,
+    0.85412949f, 0.85324395f, 0.85236293f, 0.85148644f, 0.85061449f, 0.84974694f, 0.84888381f, 0.84802508f,
+    0.84717065f, 0.84632051f, 0.84547460f, 0.84463292f, 0.84379536f, 0.84296203f, 0.84213275f, 0.84130752f,
+    0.84007722f, 0.83845073f, 0.83683985f, 0.83524436f, 0.83366394f, 0.83209836f, 0.83054739f, 0.82901078f,
+    0.82748824f, 0.82597959f, 0.82448459f, 0.82300305f, 0.82153469f, 0.82007939f, 0.81863683f, 0.81720686f,
+    0.81578934f, 0.81438404f, 0.81299073f, 0.81160927f, 0.81023943f, 0.80888110f, 0.80753410f, 0.80619824f,
+    0.80487335f, 0.80355924f, 0.80225581f, 0.80096287f, 0.79968029f, 0.79840797f, 0.79714566f, 0.79589325f,
+    0.79465061f, 0.79341763f, 0.79219419f, 0.79098010f, 0.78977525f, 0.78857952f, 0.78739280f, 0.78621495f,
+    0.78504586f, 0.78388536f, 0.78273344f, 0.78158993f, 0.78045475f, 0.77932769f, 0.77820879f, 0.77709788f,
+    0.77599484f, 0.77489954f, 0.77381194f, 0.77273196f, 0.77165949f, 0.77059436f, 0.76953661f, 0.76848602f,
+    0.76744258f, 0.76640624f, 0.76537681f, 0.76435423f, 0.76333851f, 0.76232946f, 0.76132703f, 0.76033115f,
+    0.75934178f, 0.75835884f, 0.75738221f, 0.75641179f, 0.75544763f, 0.75448954f, 0.75353748f, 0.75259143f,
+    0.75165129f, 0.75071698f, 0.74978846f, 0.74886560f, 0.74794847f, 0.74703687f, 0.74613082f, 0.74523026f,
+    0.74433506f, 0.74344522f, 0.74256068f, 0.74168140f, 0.74080729f, 0.73993832f, 0.73907441f, 0.73821551f,
+    0.73736161f, 0.73651260f, 0.73566848f, 0.73482913f, 0.73399454f, 0.73316473f, 0.73233956f, 0.73151898f,
+    0.73070306f, 0.72989160f, 0.72908461f, 0.72828209f, 0.72748399f, 0.72669023f, 0.72590077f, 0.72511560f,
+    0.72433466f, 0.72355789f, 0.72278523f, 0.72201675f, 0.72125232f, 0.72049189f, 0.71973544f, 0.71898299f,
+    0.71823442f, 0.71748978f, 0.71674895f, 0.71601194f, 0.71527869f, 0.71454918f, 0.71382338f, 0.71310127f,
+    0.71238273f, 0.71166784f, 0.71095657f, 0.71024877f, 0.70954454f, 0.70884371f, 0.70814639f, 0.70745248f,
+    0.70641792f, 0.70505023f, 0.70369565f, 0.70235401f, 0.70102501f, 0.69970852f, 0.69840431f, 0.69711220f,
+    0.69583189f, 0.69456327f, 0.69330615f, 0.69206029f, 0.69082558f, 0.68960178f, 0.68838876f, 0.68718636f,
+    0.68599433f, 0.68481261f, 0.68364096f, 0.68247932f, 0.68132746f, 0.68018526f, 0.67905253f, 0.67792922f,
+    0.67681509f, 0.67571008f, 0.67461401f, 0.67352682f, 0.67244834f, 0.67137837f, 0.67031693f, 0.66926378f,
+    0.66821885f, 0.66718209f, 0.66615325f, 0.66513234f, 0.66411918f, 0.66311371f, 0.66211575f, 0.66112530f,
+    0.66014224f, 0.65916640f, 0.65819776f, 0.65723616f, 0.65628159f, 0.65533388f, 0.65439296f, 0.65345883f,
+    0.65253127f, 0.65161026f, 0.65069568f, 0.64978755f, 0.64888567f, 0.64799005f, 0.64710057f, 0.64621717f,
+    0.64533973f, 0.64446825f, 0.64360261f, 0.64274275f, 0.64188862f, 0.64104009f, 0.64019716f, 0.63935977f,
+    0.63852781f, 0.63770121f, 0.63687998f, 0.63606399f, 0.63525319f, 0.63444752f, 0.63364697f, 0.63285142f,
+    0.63206089f, 0.63127518f, 0.63049442f, 0.62971842f, 0.62894720f, 0.62818062f, 0.62741876f, 0.62666142f,
+    0.62590867f, 0.62516046f, 0.62441665f, 0.62367725f, 0.62294221f, 0.62221152f, 0.62148505f, 0.62076277f,
+    0.62004471f, 0.61933082f, 0.61862099f, 0.61791515f, 0.61721343f, 0.61651558f, 0.61582172f, 0.61513174f,
+    0.61444557f, 0.61376321f, 0.61308467f, 0.61240983f, 0.61173868f, 0.61107123f, 0.61040735f, 0.60974711f,
+    0.60909039f, 0.60843724f, 0.60778755f, 0.60714132f, 0.60649848f, 0.60585904f, 0.60522294f, 0.60459024f,
+    0.60396075f, 0.60333455f, 0.60271162f, 0.60209185f, 0.60147530f, 0.60086185f, 0.60025150f, 0.59964430f,
+    0.59904009f, 0.59843898f, 0.59784085f, 0.59724563f, 0.59665346f, 0.59606415f, 0.59547776f, 0.59489423f,
+    0.59402430f, 0.59287423f, 0.59173512f, 0.59060693f, 0.58948946f, 0.58838242f, 0.58728570f, 0.58619910f,
+    0.58512253f, 0.58405578f, 0.58299863f, 0.58195102f, 0.58091277f, 0.57988369f, 0.57886368f, 0.57785255f,
+    0.57685018f, 0.57585645f, 0.57487124f, 0.57389438f, 0.57292581f, 0.57196534f, 0.57101285f, 0.57006824f,
+    0.56913137f, 0.56820220f, 0.56728053f, 0.56636631f, 0.56545937f, 0.56455970f, 0.56366712f, 0.56278151f,
+    0.56190288f, 0.56103098f, 0.56016588f, 0.55930740f, 0.55845541f, 0.55760992f, 0.55677080f, 0.55593789f,
+    0.55511123f, 0.55429065f, 0.55347615f, 0.55266756f, 0.55186486f, 0.55106789f, 0.55027670f, 0.54949117f,
+    0.54871118f, 0.54793674f, 0.54716766f, 0.54640400f, 0.54564565f, 0.54489249f, 0.54414457f, 0.54340166f,
+    0.54266387f, 0.54193103f, 0.54120314f, 0.54048008f, 0.53976184f, 0.53904831f, 0.53833950f, 0.53763533f,
+    0.53693575f, 0.53624070f, 0.53555006f, 0.53486395f, 0.53418213f, 0.53350466f, 0.53283149f, 0.53216249f,
+    0.53149772f, 0.53083706f, 0.53018051f, 0.52952796f, 0.52887940f, 0.52823484f, 0.52759415f, 0.52695733f,
+    0.52632439f, 0.52569515f, 0.52506971f, 0.52444798f, 0.52382988f, 0.52321541f, 0.52260453f, 0.52199721f,
+    0.52139342f, 0.52079302f, 0.52019614f, 0.51960266f, 0.51901251f, 0.51842576f, 0.51784223f, 0.51726204f,
+    0.51668507f, 0.51611131f, 0.51554066f, 0.51497322f, 0.51440889f, 0.51384759f, 0.51328933f, 0.51273417f,
+    0.51218194f, 0.51163268f, 0.51108634f, 0.51054293f, 0.51000237f, 0.50946468f, 0.50892985f, 0.50839776f,
+    0.50786847f, 0.50734186f, 0.50681806f, 0.50629687f, 0.50577837f, 0.50526255f, 0.50474936f, 0.50423872f,
+    0.50373065f, 0.50322515f, 0.50272220f, 0.50222170f, 0.50172377f, 0.50122821f, 0.50073510f, 0.50024444f,
+};
+
+float FastFourthRoot(float value)
 {
-    float vdd;
-    float ta;
-    float gain;
-    float irDataCP;
-    float irData;
-    float alphaCompensated;
-    float image;
-    uint16_t subPage;
+    union {
+        float f;
+        uint32_t u;
+    } bits;
+    int32_t exponent;
+    float inverse;
+    float inverse2;
 
-    subPage = frameData[241];
+    if (!(value > 0))
+    {
+        return sqrtf(sqrtf(value));
+    }
 
-    vdd = MLX90641_GetVdd(frameData, params);
-    ta = MLX90641_GetTa(frameData, params);
+    // Seed 1 / value^(1/4) from the lowest two exponent bits and top 7
+    // mantissa bits, then scale by the remaining power of 2^4.
+    bits.f = value;
+    exponent = (int32_t)(bits.u >> 23) - 127;
+    bits.f = inverseFourthRootSeed[((exponent & 3) << 7) | ((bits.u >> 16) & 127)];
+    bits.u -= (uint32_t)(exponent >> 2) << 23;
+    inverse = bits.f;
 
-    //------------------------- Gain calculation -----------------------------------
-    gain = frameData[202];
-    if (gain > 32767)
+    // One (division-free) Newton step for 1 / inverse^4 - value = 0
+    inverse2 = inverse * inverse;
+    inverse = inverse * (1.25f - 0.25f * value * inverse2 * inverse2);
+
+    // value^(1/4) == value * (1 / value^(1/4))^3
+    return value * inverse * inverse * inverse;
+}
+
+//------------------------------------------------------------------------------
+
+int64_t FloatToFixed(float value, int fractionBits)
+{
+    return llroundf(ldexpf(value, fractionBits));
+}
+
+//------------------------------------------------------------------------------
+
+uint32_t SquareRoot64(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    uint64_t trial;
+    uint64_t mask;
+
+    while (bit > value)
     {
-        gain = gain - 65536;
+        bit >>= 2;
     }
 
-    gain = params->gainEE / gain;
+    // Branch-free digit-by-digit square root
+    while (bit != 0)
+    {
+        trial = root + bit;
+        mask = -(uint64_t)(value >= trial);
+        value -= trial & mask;
+        root = (root >> 1) + (bit & mask);
+        bit >>= 2;
+    }
 
-    //------------------------- Image calculation -------------------------------------
-    irDataCP = frameData[200];
-    if (irDataCP > 32767)
+    return root;
+}
+
+//------------------------------------------------------------------------------
+
+int64_t FourthRootQ16(int64_t value)
+{
+    // Input in K^4, result in Q16 K. Clamped to [0 .. 2^42) K^4
+    // (i.e. up to ~1448 K) to keep intermediate results within 64 bits.
+    if (value <= 0)
     {
-        irDataCP = irDataCP - 65536;
+        return 0;
     }
-    irDataCP = irDataCP * gain;
+    if (value >= ((int64_t)1 << 42))
+    {
+        value = ((int64_t)1 << 42) - 1;
+    }
+
+    uint64_t square = SquareRoot64((uint64_t)value << 22); // T^2 in Q11
+    return SquareRoot64(square << 21);
+}
+
+//------------------------------------------------------------------------------
+
+void MLX90641_GetSceneCacheStats(sceneCacheStatsMLX90641 *stats)
+{
+    *stats = sceneCacheStats;
+}
+
+//------------------------------------------------------------------------------
+
+// Calculates the IR intensity of each pixel, i.e. the compensated IR data
+// divided by the pixel's sensitivity, without solving for To. For an
+// emissivity of 1, this is roughly To^4 - Ta^4 (in K^4), so it's useful for
+// e.g. motion detection at high frame rates.
+void MLX90641_GetImage(uint16_t *frameData, const paramsMLX90641 *params, const frameContextMLX90641 *context,
+                       float *result)
+{
+    float vdd;
+    float ta;
+    float gain;
+    float irDataCP;
+    float irData;
+    float taDelta;
+    float imageScale;
+    uint16_t subPage;
+    const compiledMLX90641 *compiled = &params->compiled;
+
+    subPage = context->subPage;
+    vdd = context->vdd;
+    ta = context->ta;
+    gain = context->gain;
+    irDataCP = context->irDataCP;
 
-    irDataCP = irDataCP - params->cpOffset * (1 + params->cpKta * (ta - 25)) * (1 + params->cpKv * (vdd - 3.3));
+    //------------------------- Image calculation -------------------------------------
+    taDelta = ta - 25;
+    imageScale = 1 / (1 + params->KsTa * taDelta);
 
     for (int pixelNumber = 0; pixelNumber < 192; pixelNumber++)
     {
@@ -718,16 +1103,12 @@ void MLX90641_GetImage(uint16_t *frameData, const paramsMLX90641 *params, float
         }
         irData = irData * gain;
 
-        irData = irData - params->offset[subPage][pixelNumber] * (1 + params->kta[pixelNumber] * (ta - 25)) *
-                              (1 + params->kv[pixelNumber] * (vdd - 3.3));
+        irData = irData - compiled->offset[subPage][pixelNumber] * (1 + compiled->kta[pixelNumber] * taDelta) *
+                              (1 + compiled->kv[pixelNumber] * (vdd - MLX_REAL(3.3)));
 
         irData = irData - params->tgc * irDataCP;
 
-        alphaCompensated = (params->alpha[pixelNumber] - params->tgc * params->cpAlpha);
-
-        image = irData * alphaCompensated;
-
-        result[pixelNumber] = image;
+        result[pixelNumber] = irData * compiled->alphaInv[pixelNumber] * imageScale;
     }
 }
 
@@ -746,8 +1127,8 @@ float MLX90641_GetVdd(uint16_t *frameData, const paramsMLX90641 *params)
         vdd = vdd - 65536;
     }
     resolutionRAM = (frameData[240] & 0x0C00) >> 10;
-    resolutionCorrection = pow(2, (double)params->resolutionEE) / pow(2, (double)resolutionRAM);
-    vdd = (resolutionCorrection * vdd - params->vdd25) / params->kVdd + 3.3;
+    resolutionCorrection = (float)(1 << params->resolutionEE) / (1 << resolutionRAM);
+    vdd = (resolutionCorrection * vdd - params->vdd25) / params->kVdd + MLX_REAL(3.3);
 
     return vdd;
 }
@@ -755,14 +1136,18 @@ float MLX90641_GetVdd(uint16_t *frameData, const paramsMLX90641 *params)
 //------------------------------------------------------------------------------
 
 float MLX90641_GetTa(uint16_t *frameData, const paramsMLX90641 *params)
+{
+    return CalculateTa(frameData, params, MLX90641_GetVdd(frameData, params));
+}
+
+//------------------------------------------------------------------------------
+
+float CalculateTa(uint16_t *frameData, const paramsMLX90641 *params, float vdd)
 {
     float ptat;
     float ptatArt;
-    float vdd;
     float ta;
 
-    vdd = MLX90641_GetVdd(frameData, params);
-
     ptat = frameData[224];
     if (ptat > 32767)
     {
@@ -774,9 +1159,9 @@ float MLX90641_GetTa(uint16_t *frameData, const paramsMLX90641 *params)
     {
         ptatArt = ptatArt - 65536;
     }
-    ptatArt = (ptat / (ptat * params->alphaPTAT + ptatArt)) * pow(2, (double)18);
+    ptatArt = (ptat / (ptat * params->alphaPTAT + ptatArt)) * (float)(1 << 18);
 
-    ta = (ptatArt / (1 + params->KvPTAT * (vdd - 3.3)) - params->vPTAT25);
+    ta = (ptatArt / (1 + params->KvPTAT * (vdd - MLX_REAL(3.3))) - params->vPTAT25);
     ta = ta / params->KtPTAT + 25;
 
     return ta;
@@ -784,6 +1169,45 @@ float MLX90641_GetTa(uint16_t *frameData, const paramsMLX90641 *params)
 
 //------------------------------------------------------------------------------
 
+void MLX90641_GetFrameContext(uint16_t *frameData, const paramsMLX90641 *params, frameContextMLX90641 *context)
+{
+    float vdd;
+    float ta;
+    float gain;
+    float irDataCP;
+
+    vdd = MLX90641_GetVdd(frameData, params);
+    ta = CalculateTa(frameData, params, vdd);
+
+    //------------------------- Gain calculation -----------------------------------
+    gain = frameData[202];
+    if (gain > 32767)
+    {
+        gain = gain - 65536;
+    }
+
+    gain = params->gainEE / gain;
+
+    //------------------------- CP compensation ------------------------------------
+    irDataCP = frameData[200];
+    if (irDataCP > 32767)
+    {
+        irDataCP = irDataCP - 65536;
+    }
+    irDataCP = irDataCP * gain;
+
+    irDataCP = irDataCP - params->cpOffset * (1 + params->cpKta * (ta - 25)) *
+                              (1 + params->cpKv * (vdd - MLX_REAL(3.3)));
+
+    context->vdd = vdd;
+    context->ta = ta;
+    context->gain = gain;
+    context->irDataCP = irDataCP;
+    context->subPage = frameData[241];
+}
+
+//------------------------------------------------------------------------------
+
 int MLX90641_GetSubPageNumber(uint16_t *frameData)
 {
     return frameData[241];
@@ -792,44 +1216,97 @@ int MLX90641_GetSubPageNumber(uint16_t *frameData)
 //------------------------------------------------------------------------------
 void MLX90641_BadPixelsCorrection(uint16_t *pixels, float *to, paramsMLX90641 *params)
 {
-    float ap[2];
-    uint8_t pix;
-    uint8_t line;
-    uint8_t column;
+    badPixelTableMLX90641 table;
+
+    MLX90641_BuildBadPixelTable(pixels, &table);
+    MLX90641_ApplyBadPixelTable(&table, to);
+}
+
+//------------------------------------------------------------------------------
+
+// Replaces each bad pixel by the weighted average of its (up to 8) good
+// neighbours, with diagonal neighbours weighted by 1 / sqrt(2).
+// pixels is a list of pixel numbers, terminated by 0xFFFF. Returns -3 if
+// the list is too long or a pixel has no good neighbours; the table is
+// still usable, but those pixels won't be corrected.
+int MLX90641_BuildBadPixelTable(const uint16_t *pixels, badPixelTableMLX90641 *table)
+{
+    bool bad[192] = {false};
+    int error = 0;
+    int count = 0;
+
+    while (pixels[count] < 192 && count < MLX90641_BAD_PIXELS_MAX)
+    {
+        bad[pixels[count]] = true;
+        count++;
+    }
+    if (pixels[count] != 0xFFFF)
+    {
+        error = -3;
+    }
 
-    pix = 0;
-    while (pixels[pix] < 65535)
+    table->count = count;
+    for (int i = 0; i < count; i++)
     {
-        line = pixels[pix] >> 5;
-        column = pixels[pix] - (line << 5);
+        int row = pixels[i] / 16;
+        int column = pixels[i] % 16;
+        int neighbours = 0;
+        float totalWeight = 0;
 
-        if (column == 0)
+        for (int dy = -1; dy <= 1; dy++)
         {
-            to[pixels[pix]] = to[pixels[pix] + 1];
+            for (int dx = -1; dx <= 1; dx++)
+            {
+                int y = row + dy;
+                int x = column + dx;
+                if ((dx == 0 && dy == 0) || y < 0 || y >= 12 || x < 0 || x >= 16 || bad[y * 16 + x])
+                {
+                    continue;
+                }
+
+                table->neighbour[i][neighbours] = y * 16 + x;
+                table->weight[i][neighbours] = (dx != 0 && dy != 0) ? 0.70710678f : 1.0f;
+                totalWeight += table->weight[i][neighbours];
+                neighbours++;
+            }
         }
-        else if (column == 1 || column == 14)
+
+        for (int n = 0; n < neighbours; n++)
         {
-            to[pixels[pix]] = (to[pixels[pix] - 1] + to[pixels[pix] + 1]) / 2.0;
+            table->weight[i][n] /= totalWeight;
         }
-        else if (column == 15)
+
+        if (neighbours == 0)
         {
-            to[pixels[pix]] = to[pixels[pix] - 1];
+            error = -3;
         }
-        else
+
+        table->pixel[i] = pixels[i];
+        table->neighbourCount[i] = neighbours;
+    }
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+
+void MLX90641_ApplyBadPixelTable(const badPixelTableMLX90641 *table, float *to)
+{
+    for (int i = 0; i < table->count; i++)
+    {
+        float value;
+
+        if (table->neighbourCount[i] == 0)
         {
-            ap[0] = to[pixels[pix] + 1] - to[pixels[pix] + 2];
-            ap[1] = to[pixels[pix] - 1] - to[pixels[pix] - 2];
-            if (fabs(ap[0]) > fabs(ap[1]))
-            {
-                to[pixels[pix]] = to[pixels[pix] - 1] + ap[1];
-            }
-            else
-            {
-                to[pixels[pix]] = to[pixels[pix] + 1] + ap[0];
-            }
+            continue;
         }
 
-        pix = pix + 1;
+        value = 0;
+        for (int n = 0; n < table->neighbourCount[i]; n++)
+        {
+            value += table->weight[i][n] * to[table->neighbour[i][n]];
+        }
+        to[table->pixel[i]] = value;
     }
 }
 
@@ -1270,6 +1747,72 @@ void ExtractCPParameters(uint16_t *eeData, paramsMLX90641 *mlx90641)
 
 //------------------------------------------------------------------------------
 
+void CompileParameters(paramsMLX90641 *mlx90641)
+{
+    compiledMLX90641 *compiled = &mlx90641->compiled;
+    float ktaScale;
+    float kvScale;
+    float alphaScale;
+
+    ktaScale = pow(2, (double)mlx90641->ktaScale);
+    kvScale = pow(2, (double)mlx90641->kvScale);
+    alphaScale = pow(2, (double)mlx90641->alphaScale);
+
+    for (int i = 0; i < 8; i++)
+    {
+        compiled->ct[i] = mlx90641->ct[i];
+    }
+
+    compiled->alphaCorrR[1] = 1 / (1 + mlx90641->ksTo[1] * 20);
+    compiled->alphaCorrR[0] = compiled->alphaCorrR[1] / (1 + mlx90641->ksTo[0] * 20);
+    compiled->alphaCorrR[2] = 1;
+    compiled->alphaCorrR[3] = (1 + mlx90641->ksTo[2] * mlx90641->ct[3]);
+    for (int i = 4; i < 8; i++)
+    {
+        compiled->alphaCorrR[i] =
+            compiled->alphaCorrR[i - 1] * (1 + mlx90641->ksTo[i - 1] * (mlx90641->ct[i] - mlx90641->ct[i - 1]));
+    }
+
+    for (int i = 0; i < 192; i++)
+    {
+        compiled->kta[i] = (float)mlx90641->kta[i] / ktaScale;
+        compiled->kv[i] = (float)mlx90641->kv[i] / kvScale;
+        compiled->alpha[i] = SCALEALPHA * alphaScale / mlx90641->alpha[i];
+        compiled->alphaInv[i] = mlx90641->alpha[i] / (SCALEALPHA * alphaScale);
+        compiled->offset[0][i] = mlx90641->offset[0][i];
+        compiled->offset[1][i] = mlx90641->offset[1][i];
+    }
+
+    CompileFixedParameters(mlx90641);
+}
+
+//------------------------------------------------------------------------------
+
+void CompileFixedParameters(paramsMLX90641 *mlx90641)
+{
+    fixedMLX90641 *fixed = &mlx90641->fixed;
+    uint64_t alphaInv;
+
+    for (int i = 0; i < 8; i++)
+    {
+        fixed->alphaCorrR[i] = FloatToFixed(mlx90641->compiled.alphaCorrR[i], 20);
+        fixed->ksTo[i] = FloatToFixed(mlx90641->ksTo[i], 30);
+    }
+
+    // 1 / alpha == alpha[i] / (SCALEALPHA * 2^alphaScale)
+    for (int i = 0; i < 192; i++)
+    {
+        alphaInv = ((uint64_t)mlx90641->alpha[i] * (uint64_t)(1 / SCALEALPHA + 0.5)) << 8;
+        if (mlx90641->alphaScale > 0)
+        {
+            alphaInv = (alphaInv + ((uint64_t)1 << (mlx90641->alphaScale - 1))) >> mlx90641->alphaScale;
+        }
+        fixed->alphaInv[i] = alphaInv > UINT32_MAX ? UINT32_MAX : alphaInv;
+    }
+}
+
+//------------------------------------------------------------------------------
+
 float MLX90641_GetEmissivity(const paramsMLX90641 *mlx90641)
 {
     return mlx90641->emissivityEE;
@@ -25,6 +25,62 @@ extern "C" {
 
 #define SCALEALPHA 0.000001
 
+#define MLX90641_BAD_PIXELS_MAX 8
+
+// Return values of MLX90641_StepFrameData(), besides sub-page number and errors
+#define MLX90641_FRAME_NOT_READY 2
+#define MLX90641_FRAME_IN_PROGRESS 3
+
+// Return value of MLX90641_StepTrigger() until the measurement is triggered
+#define MLX90641_TRIGGER_IN_PROGRESS 3
+
+// Number of times MLX90641_StepFrameData() retries a failed transfer of a
+// frame, before giving up on it
+#ifndef MLX90641_FRAME_RETRIES
+#define MLX90641_FRAME_RETRIES 2
+#endif
+
+/**
+ * Per-pixel calibration data, pre-scaled to floats for use by the To
+ * calculation. Built by MLX90641_ExtractParameters() from the packed
+ * EEPROM-derived values, so the per-frame loop only has to read them.
+ */
+typedef struct
+{
+    float kta[192];
+    float kv[192];
+    float alpha[192];
+    float alphaInv[192];
+    float offset[2][192];
+    float alphaCorrR[8];
+    float ct[8];
+} compiledMLX90641;
+
+/**
+ * Neighbouring pixels and their weights to use as replacement value for
+ * each bad pixel. Build it using MLX90641_BuildBadPixelTable(), apply it
+ * using MLX90641_ApplyBadPixelTable().
+ */
+typedef struct
+{
+    uint8_t count;
+    uint8_t pixel[MLX90641_BAD_PIXELS_MAX];
+    uint8_t neighbourCount[MLX90641_BAD_PIXELS_MAX];
+    uint8_t neighbour[MLX90641_BAD_PIXELS_MAX][8];
+    float weight[MLX90641_BAD_PIXELS_MAX][8];
+} badPixelTableMLX90641;
+
+/**
+ * Calibration data in fixed-point format, for MLX90641_CalculateToFixed().
+ * Built by MLX90641_ExtractParameters().
+ */
+typedef struct
+{
+    uint32_t alphaInv[192]; // 1 / alpha, Q8
+    int32_t alphaCorrR[8];  // Q20
+    int64_t ksTo[8];        // Q30
+} fixedMLX90641;
+
 typedef struct
 {
     int16_t kVdd;
@@ -52,25 +108,113 @@ typedef struct
     float cpAlpha;
     int16_t cpOffset;
     float emissivityEE;
-    uint16_t brokenPixels[2];
+    uint16_t brokenPixels[3]; // Terminated by 0xFFFF
+    compiledMLX90641 compiled;
+    fixedMLX90641 fixed;
+    badPixelTableMLX90641 badPixelTable; // Built from brokenPixels
 } paramsMLX90641;
 
+/**
+ * Values decoded once per frame from the auxiliary data of a frameData
+ * buffer, shared by all radiometry functions. Fill it using
+ * MLX90641_GetFrameContext().
+ */
+typedef struct
+{
+    float vdd;
+    float ta;
+    float gain;
+    float irDataCP;
+    uint16_t subPage;
+} frameContextMLX90641;
+
+/**
+ * State of an incremental frame read, see MLX90641_StepFrameData().
+ * Zero-initialize before first use.
+ */
+typedef struct
+{
+    uint8_t state;
+    uint8_t block;
+    uint8_t subPage;
+    uint8_t retries;
+} frameReaderMLX90641;
+
+/**
+ * State of an incremental measurement trigger, see MLX90641_StepTrigger().
+ * Zero-initialize before first use.
+ */
+typedef struct
+{
+    uint8_t state;
+    uint16_t controlRegister;
+} triggerMLX90641;
+
+/**
+ * Usage statistics of the cached scene constants (derived from Ta,
+ * reflected temperature and emissivity) in MLX90641_CalculateTo().
+ * Hit rate is hits / (hits + misses).
+ */
+typedef struct
+{
+    uint32_t hits;
+    uint32_t misses;
+} sceneCacheStatsMLX90641;
+
+/**
+ * Number of EEPROM words with a Hamming error found by the last
+ * MLX90641_DumpEE(). Single-bit errors are corrected, others are not.
+ */
+typedef struct
+{
+    uint16_t corrected;
+    uint16_t uncorrectable;
+} eepromStatsMLX90641;
+
+/**
+ * A batch of recorded frames for MLX90641_CalculateToBatch(), in
+ * structure-of-arrays layout: per-frame inputs and outputs are separate
+ * arrays indexed by frame number.
+ */
+typedef struct
+{
+    int frameCount;
+    uint16_t *frameData; // frameCount * 242 words, as read by MLX90641_GetFrameData()
+    float *emissivity;   // frameCount values
+    float *tr;           // frameCount values, or NULL to use ta - taShift
+    float taShift;       // Only used if tr is NULL
+    float *ta;           // Optional output: frameCount ambient temperatures, or NULL
+    float *result;       // Output: frameCount * 192 object temperatures
+} batchMLX90641;
+
 int MLX90641_DumpEE(uint8_t slaveAddr, uint16_t *eeData);
 int MLX90641_SynchFrame(uint8_t slaveAddr);
 int MLX90641_TriggerMeasurement(uint8_t slaveAddr);
+int MLX90641_StepTrigger(uint8_t slaveAddr, triggerMLX90641 *trigger);
 int MLX90641_GetFrameData(uint8_t slaveAddr, uint16_t *frameData);
+int MLX90641_StepFrameData(uint8_t slaveAddr, frameReaderMLX90641 *reader, uint16_t *frameData);
 int MLX90641_ExtractParameters(uint16_t *eeData, paramsMLX90641 *mlx90641);
 float MLX90641_GetVdd(uint16_t *frameData, const paramsMLX90641 *params);
 float MLX90641_GetTa(uint16_t *frameData, const paramsMLX90641 *params);
-void MLX90641_GetImage(uint16_t *frameData, const paramsMLX90641 *params, float *result);
-void MLX90641_CalculateTo(uint16_t *frameData, const paramsMLX90641 *params, float emissivity, float tr, float *result);
+void MLX90641_GetFrameContext(uint16_t *frameData, const paramsMLX90641 *params, frameContextMLX90641 *context);
+void MLX90641_GetImage(uint16_t *frameData, const paramsMLX90641 *params, const frameContextMLX90641 *context,
+                       float *result);
+void MLX90641_CalculateTo(uint16_t *frameData, const paramsMLX90641 *params, const frameContextMLX90641 *context,
+                          float emissivity, float tr, float *result);
+void MLX90641_CalculateToFixed(uint16_t *frameData, const paramsMLX90641 *params,
+                               const frameContextMLX90641 *context, float emissivity, float tr, float *result);
+void MLX90641_CalculateToBatch(const paramsMLX90641 *params, const batchMLX90641 *batch);
 int MLX90641_SetResolution(uint8_t slaveAddr, uint8_t resolution);
 int MLX90641_GetCurResolution(uint8_t slaveAddr);
 int MLX90641_SetRefreshRate(uint8_t slaveAddr, uint8_t refreshRate);
 int MLX90641_GetRefreshRate(uint8_t slaveAddr);
 int MLX90641_GetSubPageNumber(uint16_t *frameData);
 float MLX90641_GetEmissivity(const paramsMLX90641 *mlx90641);
+void MLX90641_GetSceneCacheStats(sceneCacheStatsMLX90641 *stats);
+void MLX90641_GetEEPROMStats(eepromStatsMLX90641 *stats);
 void MLX90641_BadPixelsCorrection(uint16_t *pixels, float *to, paramsMLX90641 *params);
+int MLX90641_BuildBadPixelTable(const uint16_t *pixels, badPixelTableMLX90641 *table);
+void MLX90641_ApplyBadPixelTable(const badPixelTableMLX90641 *table, float *to);
 
 #ifdef __cplusplus
 } /* extern "C" */
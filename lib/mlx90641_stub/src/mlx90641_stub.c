@@ -0,0 +1,21 @@
+#include <MLX90641_I2C_Driver.h>
+
+// No sensor is attached, only the driver's calculations are used
+int MLX90641_I2CGeneralReset(void)
+{
+    return -1;
+}
+
+int MLX90641_I2CRead(uint8_t slaveAddr, uint16_t startAddress, uint16_t nMemAddressRead, uint16_t *data)
+{
+    return -1;
+}
+
+int MLX90641_I2CWrite(uint8_t slaveAddr, uint16_t writeAddress, uint16_t data)
+{
+    return -1;
+}
+
+void MLX90641_I2CFreqSet(int kHz)
+{
+}
@@ -0,0 +1,119 @@
+#include "mlx90641_synthetic.h"
+
+#include <math.h>
+#include <string.h>
+
+#define PIXEL_COUNT 192
+
+void mlx90641_synthetic_eeprom(uint16_t *ee)
+{
+    uint32_t seed = 12345;
+
+    memset(ee, 0, MLX90641_SYNTHETIC_EEPROM_WORDS * sizeof(uint16_t));
+    ee[10] = 0x0040;
+    ee[16] = 1 << 5;
+    ee[17] = 2001;
+    ee[18] = 4;
+    ee[21] = 164;
+    ee[22] = (15 << 5) | 2;
+    ee[23] = 16;
+    ee[24] = (5 << 5) | 1;
+    ee[25] = (12 << 5) | 12;
+    ee[26] = (12 << 5) | 12;
+    ee[27] = (12 << 5) | 12;
+    for (int i = 0; i < 6; i++)
+    {
+        ee[28 + i] = 1288 - 20 * i;
+    }
+    ee[34] = 1982;
+    ee[35] = 512;
+    ee[36] = 170;
+    ee[37] = 24;
+    ee[38] = 1640;
+    ee[39] = 1949;
+    ee[40] = 383;
+    ee[41] = 17;
+    ee[42] = 338;
+    ee[43] = 22;
+    ee[44] = 1152;
+    ee[45] = 1118;
+    ee[46] = 38;
+    ee[47] = 2045;
+    ee[48] = 26;
+    ee[49] = (10 << 6) | 4;
+    ee[50] = (3 << 6) | 2;
+    ee[51] = 0x400 | 40;
+    ee[52] = 17;
+    ee[53] = 1943;
+    ee[54] = 1950;
+    ee[55] = 1960;
+    ee[56] = 1970;
+    ee[57] = 1980;
+    ee[58] = 200;
+    ee[59] = 1990;
+    ee[60] = 400;
+    ee[61] = 2000;
+    ee[62] = 600;
+    ee[63] = 2010;
+
+    for (int i = 0; i < PIXEL_COUNT; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        int offset = (int)((seed >> 16) % 200) - 100;
+        int kta = (int)((seed >> 20) % 20) - 10;
+        int kv = (int)((seed >> 12) % 10) - 5;
+        ee[64 + i] = offset & 0x7FF;
+        ee[640 + i] = (offset + 3) & 0x7FF;
+        ee[256 + i] = 1700 + (seed >> 8) % 300;
+        ee[448 + i] = ((kta & 0x3F) << 5) | (kv & 0x1F);
+    }
+}
+
+static int parity(uint16_t value)
+{
+    int result = 0;
+    for (; value != 0; value &= value - 1)
+    {
+        result ^= 1;
+    }
+    return result;
+}
+
+uint16_t mlx90641_synthetic_hamming_encode(uint16_t data)
+{
+    static const uint16_t checks[] = {0x0D5B, 0x166D, 0x278E, 0x47F0};
+
+    data &= 0x07FF;
+    for (int i = 0; i < 4; i++)
+    {
+        data |= parity(data & checks[i]) << (11 + i);
+    }
+    return data | parity(data) << 15;
+}
+
+void mlx90641_synthetic_frame(const paramsMLX90641 *params, const float *temps, float ta, float vdd, int subPage,
+                              uint16_t *frameData)
+{
+    float ptatArt = ((ta - 25) * params->KtPTAT + params->vPTAT25) * (1 + params->KvPTAT * (vdd - 3.3f));
+    float ptat = 1700;
+    double ta4 = pow(ta + 273.15, 4);
+
+    memset(frameData, 0, MLX90641_SYNTHETIC_FRAME_WORDS * sizeof(uint16_t));
+    frameData[192] = (uint16_t)lrintf(ptat * 262144.0f / ptatArt - ptat * params->alphaPTAT);
+    frameData[200] = (uint16_t)(params->cpOffset + 3);
+    frameData[202] = params->gainEE;
+    frameData[224] = (uint16_t)ptat;
+    frameData[234] = (uint16_t)lrintf(params->vdd25 + (vdd - 3.3f) * params->kVdd);
+    frameData[240] = 0x0800 | (4 << 7);
+    frameData[241] = subPage;
+
+    for (int i = 0; i < PIXEL_COUNT; i++)
+    {
+        double alpha = SCALEALPHA * pow(2, params->alphaScale) / params->alpha[i];
+        double kta = params->kta[i] / pow(2, params->ktaScale);
+        double kv = params->kv[i] / pow(2, params->kvScale);
+        double irData = alpha * (pow(temps[i] + 273.15, 4) - ta4);
+        irData += params->offset[subPage][i] * (1 + kta * (ta - 25)) * (1 + kv * (vdd - 3.3));
+        frameData[i] = (uint16_t)lrint(irData);
+    }
+}
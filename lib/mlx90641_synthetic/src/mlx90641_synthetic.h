@@ -0,0 +1,54 @@
+#ifndef MLX90641_SYNTHETIC_H
+#define MLX90641_SYNTHETIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <MLX90641_API.h>
+
+#include <stdint.h>
+
+/**
+ * Synthetic MLX90641 calibration data and frames, for running the driver
+ * without a sensor: in the simulator's emulator, the benchmark and the
+ * native tests.
+ */
+
+#define MLX90641_SYNTHETIC_EEPROM_WORDS 832
+#define MLX90641_SYNTHETIC_FRAME_WORDS 242
+
+/**
+ * Fill EEPROM data (as returned by MLX90641_DumpEE(), i.e. without Hamming
+ * code) with plausible calibration values. Always the same values.
+ *
+ * @param ee MLX90641_SYNTHETIC_EEPROM_WORDS words of EEPROM data.
+ */
+void mlx90641_synthetic_eeprom(uint16_t *ee);
+
+/**
+ * Add Hamming code (bits 11..15) to an 11-bit EEPROM word, as checked by
+ * MLX90641_DumpEE().
+ */
+uint16_t mlx90641_synthetic_hamming_encode(uint16_t data);
+
+/**
+ * Build a frame (as returned by MLX90641_GetFrameData()) of a scene with
+ * the given object temperatures, by running the To calculation backwards
+ * (for an emissivity of 1 and reflected temperature Ta).
+ *
+ * @param params Calibration parameters.
+ * @param temps Object temperature of each of the 192 pixels.
+ * @param ta Ambient (sensor) temperature.
+ * @param vdd Supply voltage.
+ * @param subPage Sub-page to build, 0 or 1.
+ * @param frameData MLX90641_SYNTHETIC_FRAME_WORDS words of frame data.
+ */
+void mlx90641_synthetic_frame(const paramsMLX90641 *params, const float *temps, float ta, float vdd, int subPage,
+                              uint16_t *frameData);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*MLX90641_SYNTHETIC_H*/
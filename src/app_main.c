@@ -1,7 +1,14 @@
 #include "app_main.h"
+#include "diagnostics.h"
 #include "focus.h"
 #include "header.h"
+#include "latency.h"
 #include "materials.h"
+#include "motion.h"
+#include "pipeline.h"
+#include "recording.h"
+#include "refresh_rate.h"
+#include "resolution_benchmark.h"
 #include "settings.h"
 #include "storage.h"
 #include "thermal_img.h"
@@ -26,11 +33,171 @@ static Settings settings = {
     .max_temp = 38.0,
     .flip_hor = false,
     .flip_ver = false,
+    .refresh_rate = THERMAL_REFRESH_8HZ,
+    .fusion = THERMAL_FUSION_MOTION,
+    .resolution = THERMAL_RESOLUTION_18BIT,
+    .capture = SETTINGS_CAPTURE_CONTINUOUS,
+    .bus_clock = 1000,
 };
 
-static void settings_closed_cb(void)
+/**
+ * Magic number of sensor calibration data in storage.
+ * The version number is a key computed by the HAL.
+ */
+#define CALIBRATION_MAGIC (0xca11b0a7)
+
+static bool calibration_load(uint32_t key, void *data, size_t len)
+{
+    return storage_read(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, key, data, len);
+}
+
+static bool calibration_store(uint32_t key, const void *data, size_t len)
+{
+    return storage_write(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, key, data, len);
+}
+
+static const ThermalCalibrationCache calibration_cache = {
+    .load = calibration_load,
+    .store = calibration_store,
+};
+
+/**
+ * Calibration cache to initialize the camera with, NULL when storage is not
+ * available.
+ */
+static const ThermalCalibrationCache *camera_cache = NULL;
+
+/**
+ * Whether camera initialization completed, the UI is already running before.
+ */
+static bool camera_ready = false;
+
+/**
+ * Time to wait before retrying camera initialization after a failure, in ms.
+ */
+#define CAMERA_RETRY_INTERVAL 5000
+
+/**
+ * Time app_init() was called, for reporting startup times.
+ */
+static unsigned long start_time;
+
+/**
+ * When true, sensor delivers raw IR intensity at a high rate, which is only
+ * used for motion detection.
+ */
+static bool raw_mode = false;
+
+/**
+ * Refresh rate the sensor is currently set to, -1 when unknown.
+ */
+static int current_refresh_rate = -1;
+
+/**
+ * ADC resolution the sensor is currently set to, -1 when unknown.
+ */
+static int current_resolution = -1;
+
+/**
+ * Bus clock setting currently applied to the sensor, -1 when unknown.
+ */
+static int current_bus_clock = -1;
+
+/**
+ * Capture mode the sensor is currently set to, -1 when unknown.
+ */
+static int current_capture_mode = -1;
+
+/**
+ * Time of the last triggered capture (in step mode), and whether its frame
+ * is still being measured.
+ */
+static unsigned long trigger_time;
+static bool triggered = false;
+
+/**
+ * Frame pipeline (see PipelineStage): each stage processes the newest output
+ * of the previous one, identified by its sequence number, and is skipped
+ * when a newer frame from the sensor is already waiting.
+ */
+static uint32_t frame_sequence = 0;
+static uint32_t acquired_sequence = 0;
+static PipelineBuffer radiometry_buffer;
+static PipelineBuffer post_process_buffer;
+static uint32_t colorized_sequence = 0;
+static uint32_t presented_sequence = 0;
+
+/**
+ * Maximum number of queued frames to process per call to app_tick(), to
+ * keep the UI responsive when frames arrive faster than they can be processed.
+ */
+#define MAX_FRAMES_PER_TICK 8
+
+static void settings_closed_cb(SettingsAction action)
+{
+    if (action == SETTINGS_ACTION_RESOLUTION_BENCHMARK)
+    {
+        resolution_benchmark_start();
+    }
+    else if (action == SETTINGS_ACTION_DIAGNOSTICS)
+    {
+        diagnostics_show();
+    }
+}
+
+static void toggle_raw_mode()
 {
-    /* no-op */
+    ThermalMode mode = raw_mode ? THERMAL_MODE_TEMPERATURE : THERMAL_MODE_RAW;
+    if (!hal_thermal_set_mode(mode))
+    {
+        hal_printf("ERROR: Switching thermal mode failed.\n");
+        return;
+    }
+
+    raw_mode = !raw_mode;
+    // Motion detection compares consecutive frames, display only needs the newest
+    hal_thermal_set_queue_policy(raw_mode ? THERMAL_QUEUE_ALL : THERMAL_QUEUE_LATEST);
+    motion_reset();
+    hal_led(false);
+    hal_printf(raw_mode ? "Motion detection started.\n" : "Motion detection stopped.\n");
+}
+
+static void trigger_capture()
+{
+    if (triggered)
+    {
+        // Previous frame is still being measured
+        return;
+    }
+    if (!hal_thermal_trigger())
+    {
+        hal_printf("ERROR: Triggering capture failed.\n");
+        return;
+    }
+    trigger_time = hal_millis();
+    triggered = true;
+}
+
+static void toggle_recording()
+{
+    if (!recording_is_active())
+    {
+        if (!recording_start())
+        {
+            hal_printf("ERROR: Starting recording failed.\n");
+            return;
+        }
+        hal_printf("Recording started.\n");
+        return;
+    }
+
+    if (!recording_stop())
+    {
+        hal_printf("ERROR: Storing recording failed.\n");
+        return;
+    }
+    hal_printf("Recording stopped.\n");
+    recording_dump();
 }
 
 static void main_event_cb(lv_obj_t *obj, lv_event_t event)
@@ -50,9 +217,24 @@ static void main_event_cb(lv_obj_t *obj, lv_event_t event)
             wait_release = true;
             break;
         case 'B':
+            if (camera_ready)
+            {
+                if (settings.capture != SETTINGS_CAPTURE_CONTINUOUS && !raw_mode)
+                {
+                    trigger_capture();
+                }
+                else
+                {
+                    toggle_raw_mode();
+                }
+            }
             wait_release = true;
             break;
         case 'C':
+            if (camera_ready)
+            {
+                toggle_recording();
+            }
             wait_release = true;
             break;
         }
@@ -65,6 +247,17 @@ static void main_event_cb(lv_obj_t *obj, lv_event_t event)
     }
 }
 
+/**
+ * Whether object needs to be put in editing mode (using Enter) for the
+ * arrow keys to change its value, instead of moving the focus.
+ */
+static bool needs_editing(lv_obj_t *obj)
+{
+    lv_obj_type_t type;
+    lv_obj_get_type(obj, &type);
+    return strcmp(type.type[0], "lv_spinbox") == 0 || strcmp(type.type[0], "lv_dropdown") == 0;
+}
+
 void print_lv_log_cb(lv_log_level_t level, const char *file, uint32_t line, const char *func, const char *desc)
 {
     const char *level_text = "<UNKNOWN>";
@@ -106,9 +299,7 @@ static bool keyboard_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
         if (new_key_pressed)
         {
             lv_obj_t *focused = lv_group_get_focused(group);
-            lv_obj_type_t type;
-            lv_obj_get_type(focused, &type);
-            if (strcmp(type.type[0], "lv_spinbox") == 0)
+            if (needs_editing(focused))
             {
                 lv_indev_wait_release(lv_indev_get_act());
 
@@ -126,9 +317,7 @@ static bool keyboard_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
         if (new_key_pressed && editing)
         {
             lv_obj_t *focused = lv_group_get_focused(group);
-            lv_obj_type_t type;
-            lv_obj_get_type(focused, &type);
-            if (strcmp(type.type[0], "lv_spinbox") == 0)
+            if (needs_editing(focused))
             {
                 lv_indev_wait_release(lv_indev_get_act());
 
@@ -191,6 +380,7 @@ static void keyboard_init()
 
 void app_init()
 {
+    start_time = hal_millis();
     lv_init();
     hal_init();
     keyboard_init();
@@ -199,14 +389,16 @@ void app_init()
     hal_printf("Thermal Camera\n");
     hal_printf("Copyright (C) 2020 Martin Poelstra\n\n");
 
-    if (!hal_flash_init())
+    bool have_storage = hal_flash_init();
+    if (!have_storage)
     {
         hal_printf("WARNING: Storage init failed: can't load/store settings\n");
     }
     else
     {
         Settings temp_settings;
-        if (!storage_read(SETTINGS_MAGIC, SETTINGS_VERSION, &temp_settings, sizeof(temp_settings)))
+        if (!storage_read(STORAGE_SLOT_SETTINGS, SETTINGS_MAGIC, SETTINGS_VERSION, &temp_settings,
+                          sizeof(temp_settings)))
         {
             hal_printf("No existing settings found, using defaults.\n");
         }
@@ -215,21 +407,72 @@ void app_init()
             hal_printf("Settings loaded from flash.\n");
             settings = temp_settings;
         }
+        camera_cache = &calibration_cache;
     }
 
-    while (!hal_thermal_init())
-    {
-        hal_printf("Camera initialization failed, retrying...\n");
-        hal_sleep(5000);
-    }
-    hal_printf("Camera initialized.\n");
-
     header_init();
     thermal_img_init();
+    latency_init();
 
     lv_obj_set_event_cb(lv_scr_act(), main_event_cb);
     lv_group_t *group = focus_push_group();
     lv_group_add_obj(group, lv_scr_act());
+
+    // Camera is initialized from app_tick(), so the UI is usable meanwhile
+    thermal_img_set_status("Connecting to camera...");
+    hal_thermal_init_start(camera_cache);
+}
+
+/**
+ * Perform the next step of camera initialization, retrying after failures.
+ * @returns true when camera is ready for use.
+ */
+static bool init_camera()
+{
+    static unsigned long retry_time;
+    static bool retrying = false;
+
+    if (camera_ready)
+    {
+        return true;
+    }
+
+    if (retrying)
+    {
+        if (hal_millis() - retry_time < CAMERA_RETRY_INTERVAL)
+        {
+            return false;
+        }
+        retrying = false;
+        thermal_img_set_status("Connecting to camera...");
+        hal_thermal_init_start(camera_cache);
+    }
+
+    switch (hal_thermal_init_step())
+    {
+    case THERMAL_INIT_BUSY:
+        return false;
+    case THERMAL_INIT_READY:
+        break;
+    case THERMAL_INIT_NOT_FOUND:
+        hal_printf("Camera not found, retrying...\n");
+        thermal_img_set_status("Camera not found");
+        retrying = true;
+        retry_time = hal_millis();
+        return false;
+    case THERMAL_INIT_FAILED:
+        hal_printf("Camera initialization failed, retrying...\n");
+        thermal_img_set_status("Camera initialization failed");
+        retrying = true;
+        retry_time = hal_millis();
+        return false;
+    }
+
+    hal_printf("Camera initialized after %lu ms.\n", hal_millis() - start_time);
+    hal_thermal_set_queue_policy(THERMAL_QUEUE_LATEST);
+    thermal_img_set_status(NULL);
+    camera_ready = true;
+    return true;
 }
 
 void flip_pixels(float pixels[THERMAL_COLS * THERMAL_ROWS], bool flip_hor, bool flip_ver)
@@ -276,17 +519,393 @@ static float get_current_emissivity()
     return materials[settings.material_index].emissivity / 1000.0;
 }
 
+/**
+ * Determine refresh rate to use, and apply it to the sensor when changed,
+ * unless the benchmark is using the sensor.
+ * @param pixels Temperatures of a new frame, or NULL if no new frame is available.
+ */
+static void update_refresh_rate(const float pixels[THERMAL_COLS * THERMAL_ROWS])
+{
+    static bool was_auto = false;
+
+    if (resolution_benchmark_is_active())
+    {
+        // Restore setting (and restart automatic rate) afterwards
+        current_refresh_rate = -1;
+        was_auto = false;
+        return;
+    }
+
+    int rate;
+    if (raw_mode)
+    {
+        // Raw mode needs much less calculation, so use the highest rate the
+        // sensor supports
+        rate = THERMAL_REFRESH_64HZ;
+    }
+    else if (settings.refresh_rate == SETTINGS_REFRESH_AUTO)
+    {
+        if (!was_auto)
+        {
+            refresh_rate_reset();
+        }
+        rate = current_refresh_rate < 0 ? THERMAL_REFRESH_8HZ : current_refresh_rate;
+        if (pixels != NULL)
+        {
+            rate = refresh_rate_update(pixels, rate);
+        }
+    }
+    else if (settings.refresh_rate <= THERMAL_REFRESH_64HZ)
+    {
+        rate = settings.refresh_rate;
+    }
+    else
+    {
+        // Fix invalid setting (shouldn't ever happen)
+        settings.refresh_rate = THERMAL_REFRESH_8HZ;
+        rate = settings.refresh_rate;
+    }
+    was_auto = !raw_mode && settings.refresh_rate == SETTINGS_REFRESH_AUTO;
+
+    if (rate != current_refresh_rate)
+    {
+        if (!hal_thermal_set_refresh_rate(rate))
+        {
+            hal_printf("ERROR: Setting refresh rate failed.\n");
+        }
+        // Don't retry until the rate changes again
+        current_refresh_rate = rate;
+    }
+}
+
+/**
+ * Apply ADC resolution setting to the sensor when changed, unless the
+ * benchmark is using the sensor.
+ */
+static void update_resolution()
+{
+    if (resolution_benchmark_is_active())
+    {
+        // Restore setting afterwards
+        current_resolution = -1;
+        return;
+    }
+
+    // Fix invalid setting (shouldn't ever happen)
+    if (settings.resolution > THERMAL_RESOLUTION_19BIT)
+    {
+        settings.resolution = THERMAL_RESOLUTION_18BIT;
+    }
+
+    if (settings.resolution != current_resolution)
+    {
+        if (!hal_thermal_set_resolution(settings.resolution))
+        {
+            hal_printf("ERROR: Setting resolution failed.\n");
+        }
+        // Don't retry until the setting changes again
+        current_resolution = settings.resolution;
+    }
+}
+
+/**
+ * Apply I2C clock setting to the sensor when changed.
+ */
+static void update_bus_clock()
+{
+    // Fix invalid setting (shouldn't ever happen)
+    if (settings.bus_clock != THERMAL_BUS_CLOCK_AUTO && (settings.bus_clock < 100 || settings.bus_clock > 1000))
+    {
+        settings.bus_clock = 1000;
+    }
+
+    if (settings.bus_clock != current_bus_clock)
+    {
+        if (!hal_thermal_set_bus_clock(settings.bus_clock))
+        {
+            hal_printf("ERROR: Setting I2C clock failed.\n");
+        }
+        // Don't retry until the setting changes again
+        current_bus_clock = settings.bus_clock;
+    }
+}
+
+/**
+ * Apply capture setting to the sensor when changed, and trigger captures at
+ * the configured interval. Raw mode and the resolution benchmark always
+ * need continuous capture.
+ */
+static void update_capture()
+{
+    // Fix invalid setting (shouldn't ever happen)
+    if (settings.capture > SETTINGS_CAPTURE_60S)
+    {
+        settings.capture = SETTINGS_CAPTURE_CONTINUOUS;
+    }
+
+    unsigned long interval = 0;
+    if (settings.capture == SETTINGS_CAPTURE_10S)
+    {
+        interval = 10000;
+    }
+    else if (settings.capture == SETTINGS_CAPTURE_60S)
+    {
+        interval = 60000;
+    }
+
+    int mode = THERMAL_CAPTURE_STEP;
+    if (settings.capture == SETTINGS_CAPTURE_CONTINUOUS || raw_mode || resolution_benchmark_is_active())
+    {
+        mode = THERMAL_CAPTURE_CONTINUOUS;
+    }
+
+    if (mode != current_capture_mode)
+    {
+        if (!hal_thermal_set_capture_mode(mode))
+        {
+            hal_printf("ERROR: Setting capture mode failed.\n");
+        }
+        // Don't retry until the mode changes again
+        current_capture_mode = mode;
+        triggered = false;
+        // Start an interval with a capture
+        trigger_time = hal_millis() - interval;
+    }
+
+    if (mode == THERMAL_CAPTURE_STEP && interval > 0 && hal_millis() - trigger_time >= interval)
+    {
+        trigger_capture();
+    }
+}
+
+/**
+ * Check whether settings used for calculating temperatures have changed
+ * since the last call.
+ */
+static bool radiometry_changed(float emissivity)
+{
+    static float last_emissivity = -1;
+    static bool last_auto_ambient = false;
+    static float last_reflected_temperature = 0;
+
+    // In auto mode, reflected temperature is filled in by the HAL
+    bool changed = emissivity != last_emissivity || settings.auto_ambient != last_auto_ambient ||
+                   (!settings.auto_ambient && settings.reflected_temperature != last_reflected_temperature);
+
+    last_emissivity = emissivity;
+    last_auto_ambient = settings.auto_ambient;
+    last_reflected_temperature = settings.reflected_temperature;
+    return changed;
+}
+
+/**
+ * Report frames that were dropped because the main loop was busy for too long.
+ */
+static void check_capture_overruns()
+{
+    static uint32_t last_overruns = 0;
+
+    ThermalCaptureStats stats;
+    hal_thermal_get_capture_stats(&stats);
+    if (stats.overruns != last_overruns)
+    {
+        hal_printf("WARNING: %lu frames dropped\n", (unsigned long)(stats.overruns - last_overruns));
+        last_overruns = stats.overruns;
+    }
+}
+
+/**
+ * Take the next captured frame from the sensor.
+ * @returns true when a frame was acquired.
+ */
+static bool acquire_stage()
+{
+    pipeline_begin(PIPELINE_ACQUIRE);
+    if (!hal_thermal_acquire())
+    {
+        return false;
+    }
+    pipeline_end(PIPELINE_ACQUIRE);
+    acquired_sequence = ++frame_sequence;
+
+    ThermalFrameTimes times;
+    hal_thermal_get_frame_times(&times);
+    latency_start(acquired_sequence, times.data_ready_us, times.read_us);
+    return true;
+}
+
+/**
+ * Calculate temperatures of the acquired frame, or recalculate the previous
+ * one to show the effect of new settings without waiting for the next frame.
+ * @returns true when a new frame from the sensor was calculated.
+ */
+static bool radiometry_stage(bool acquired, float emissivity, bool changed)
+{
+    // In step mode, both sub-pages of a triggered frame are needed
+    if (acquired && current_capture_mode == THERMAL_CAPTURE_CONTINUOUS &&
+        pipeline_skip(PIPELINE_RADIOMETRY, hal_thermal_frame_pending()))
+    {
+        // The newer frame replaces this one on the next tick
+        return false;
+    }
+
+    float *pixels = pipeline_back(&radiometry_buffer);
+    pipeline_begin(PIPELINE_RADIOMETRY);
+    if (acquired)
+    {
+        bool updated =
+            hal_thermal_calculate(pixels, emissivity, settings.auto_ambient, &settings.reflected_temperature);
+        pipeline_end(PIPELINE_RADIOMETRY);
+        if (updated)
+        {
+            pipeline_publish(&radiometry_buffer, acquired_sequence);
+            latency_mark(acquired_sequence, LATENCY_RADIOMETRY);
+        }
+        return updated;
+    }
+
+    if (changed && hal_thermal_recompute(pixels, emissivity, settings.auto_ambient, &settings.reflected_temperature))
+    {
+        pipeline_end(PIPELINE_RADIOMETRY);
+        pipeline_publish(&radiometry_buffer, ++frame_sequence);
+    }
+    return false;
+}
+
+/**
+ * Flip the newest calculated frame according to the settings.
+ */
+static void post_process_stage()
+{
+    uint32_t sequence = pipeline_front_sequence(&radiometry_buffer);
+    if (sequence == pipeline_front_sequence(&post_process_buffer) ||
+        pipeline_skip(PIPELINE_POST_PROCESS, hal_thermal_frame_pending()))
+    {
+        return;
+    }
+
+    pipeline_begin(PIPELINE_POST_PROCESS);
+    float *pixels = pipeline_back(&post_process_buffer);
+    memcpy(pixels, pipeline_front(&radiometry_buffer), sizeof(radiometry_buffer.pixels[0]));
+    flip_pixels(pixels, settings.flip_hor, settings.flip_ver);
+    pipeline_end(PIPELINE_POST_PROCESS);
+    pipeline_publish(&post_process_buffer, sequence);
+}
+
+/**
+ * Convert the newest post-processed frame to colors.
+ */
+static void colorize_stage()
+{
+    uint32_t sequence = pipeline_front_sequence(&post_process_buffer);
+    if (sequence == colorized_sequence || pipeline_skip(PIPELINE_COLORIZE, hal_thermal_frame_pending()))
+    {
+        return;
+    }
+
+    pipeline_begin(PIPELINE_COLORIZE);
+    const float *pixels = pipeline_front(&post_process_buffer);
+    thermal_img_colorize(pixels, &settings);
+    pipeline_end(PIPELINE_COLORIZE);
+    colorized_sequence = sequence;
+    latency_mark(sequence, LATENCY_COLORIZE);
+    hal_printf("temp=%.1f\n", pixels[THERMAL_COLS / 2 + THERMAL_COLS * (THERMAL_ROWS / 2)]);
+}
+
+/**
+ * Show the newest colorized frame, it's drawn by the next lv_task_handler().
+ * @returns true when a new frame was shown.
+ */
+static bool present_stage()
+{
+    if (colorized_sequence == presented_sequence ||
+        pipeline_skip(PIPELINE_PRESENT, hal_thermal_frame_pending()))
+    {
+        return false;
+    }
+
+    pipeline_begin(PIPELINE_PRESENT);
+    thermal_img_present();
+    header_update(&settings);
+    pipeline_end(PIPELINE_PRESENT);
+    presented_sequence = colorized_sequence;
+    latency_mark(presented_sequence, LATENCY_PRESENT);
+    return true;
+}
+
 void app_tick()
 {
+    static bool interactive = false;
+    static bool have_first_frame = false;
+
     lv_task_handler();
+    if (!interactive)
+    {
+        // UI has been drawn for the first time
+        hal_printf("Time to interactive: %lu ms\n", hal_millis() - start_time);
+        interactive = true;
+    }
+
+    // Also used when initializing the camera
+    update_bus_clock();
+    if (!init_camera())
+    {
+        return;
+    }
+    check_capture_overruns();
 
-    float pixels[THERMAL_COLS * THERMAL_ROWS];
     float emissivity = get_current_emissivity();
-    if (hal_thermal_tick(pixels, emissivity, settings.auto_ambient, &settings.reflected_temperature))
+
+    update_capture();
+
+    if (raw_mode)
+    {
+        // Skip temperature calculation and display update, just signal
+        // motion using the LED.
+        float pixels[THERMAL_COLS * THERMAL_ROWS];
+        for (int i = 0; i < MAX_FRAMES_PER_TICK &&
+                        hal_thermal_tick(pixels, emissivity, settings.auto_ambient, &settings.reflected_temperature);
+             i++)
+        {
+            hal_led(motion_update(pixels));
+        }
+        update_refresh_rate(NULL);
+        return;
+    }
+
+    static int current_fusion = -1;
+    if (settings.fusion != current_fusion)
+    {
+        // Fix invalid setting (shouldn't ever happen)
+        if (settings.fusion > THERMAL_FUSION_MOTION)
+        {
+            settings.fusion = THERMAL_FUSION_OFF;
+        }
+        hal_thermal_set_fusion(settings.fusion);
+        current_fusion = settings.fusion;
+    }
+
+    update_resolution();
+
+    bool changed = radiometry_changed(emissivity);
+    bool acquired = acquire_stage();
+    bool updated = radiometry_stage(acquired, emissivity, changed);
+    update_refresh_rate(updated ? pipeline_front(&radiometry_buffer) : NULL);
+    if (updated)
+    {
+        resolution_benchmark_update(pipeline_front(&radiometry_buffer));
+    }
+    if (updated && triggered)
+    {
+        hal_printf("Frame captured in %lu ms\n", hal_millis() - trigger_time);
+        triggered = false;
+    }
+
+    post_process_stage();
+    colorize_stage();
+    if (present_stage() && !have_first_frame)
     {
-        flip_pixels(pixels, settings.flip_hor, settings.flip_ver);
-        hal_printf("temp=%.1f\n", pixels[THERMAL_COLS / 2 + THERMAL_COLS * (THERMAL_ROWS / 2)]);
-        thermal_img_update(pixels, &settings);
-        header_update(&settings);
+        hal_printf("Time to first frame: %lu ms\n", hal_millis() - start_time);
+        have_first_frame = true;
     }
 }
@@ -0,0 +1,127 @@
+#include "diagnostics.h"
+
+#include "focus.h"
+#include "hal_thermal.h"
+#include "hal_time.h"
+#include "latency.h"
+#include <lvgl.h>
+
+/**
+ * Interval of updating the counters, in ms.
+ */
+#define DIAGNOSTICS_UPDATE_INTERVAL (500)
+
+typedef struct
+{
+    lv_obj_t *win;
+    lv_obj_t *stats;
+    lv_obj_t *close_btn;
+
+    lv_task_t *update_task;
+
+    // For calculating rates
+    unsigned long last_time;
+    uint32_t last_captured;
+    uint32_t last_bytes;
+} DiagnosticsWindow;
+
+static DiagnosticsWindow *diagnostics_win;
+
+static void diagnostics_close()
+{
+    focus_pop_group();
+    lv_obj_del(diagnostics_win->win);
+    lv_task_del(diagnostics_win->update_task);
+    lv_mem_free(diagnostics_win);
+    diagnostics_win = NULL;
+}
+
+static void diagnostics_close_cb(lv_obj_t *obj, lv_event_t event)
+{
+    if (event == LV_EVENT_CLICKED || event == LV_EVENT_CANCEL)
+    {
+        diagnostics_close();
+    }
+}
+
+static void update_stats()
+{
+    ThermalCaptureStats capture;
+    ThermalBusStats bus;
+    LatencyStats latency;
+    hal_thermal_get_capture_stats(&capture);
+    hal_thermal_get_bus_stats(&bus);
+    latency_get_stats(LATENCY_FLUSH, &latency);
+
+    unsigned long now = hal_millis();
+    unsigned long elapsed = now - diagnostics_win->last_time;
+    float frame_rate = 0;
+    float throughput = 0;
+    if (elapsed > 0)
+    {
+        frame_rate = (capture.captured - diagnostics_win->last_captured) * 1000.0f / elapsed;
+        throughput = (float)(bus.bytes - diagnostics_win->last_bytes) / elapsed;
+    }
+    diagnostics_win->last_time = now;
+    diagnostics_win->last_captured = capture.captured;
+    diagnostics_win->last_bytes = bus.bytes;
+
+    lv_label_set_text_fmt(diagnostics_win->stats,
+                          "Frames: %lu (%.1f/s)\n"
+                          "Dropped: %lu, skipped: %lu\n"
+                          "Errors: %lu\n"
+                          "I2C clock: %u kHz\n"
+                          "Transactions: %lu (%.1f kB/s)\n"
+                          "NACKs: %lu\n"
+                          "Invalid frames: %lu\n"
+                          "Retries: %lu, lost frames: %lu\n"
+                          "Latency p50/p95/max: %.0f/%.0f/%.0f ms",
+                          (unsigned long)capture.captured, frame_rate, (unsigned long)capture.overruns,
+                          (unsigned long)capture.skipped, (unsigned long)capture.errors, bus.clock_khz,
+                          (unsigned long)bus.transactions, throughput, (unsigned long)bus.nacks,
+                          (unsigned long)bus.invalid_frames, (unsigned long)bus.retries,
+                          (unsigned long)bus.lost_frames, latency.p50_us / 1000.0f, latency.p95_us / 1000.0f,
+                          latency.max_us / 1000.0f);
+}
+
+static void update_stats_task(lv_task_t *task)
+{
+    update_stats();
+}
+
+void diagnostics_show()
+{
+    lv_group_t *group = focus_push_group();
+
+    LV_DEBUG_ASSERT(diagnostics_win == NULL, "Diagnostics window already initialized", 0);
+    diagnostics_win = lv_mem_alloc(sizeof(DiagnosticsWindow));
+
+    // Rates are calculated from the first update on
+    ThermalCaptureStats capture;
+    ThermalBusStats bus;
+    hal_thermal_get_capture_stats(&capture);
+    hal_thermal_get_bus_stats(&bus);
+    diagnostics_win->last_time = hal_millis();
+    diagnostics_win->last_captured = capture.captured;
+    diagnostics_win->last_bytes = bus.bytes;
+
+    diagnostics_win->win = lv_win_create(lv_scr_act(), NULL);
+    lv_win_set_title(diagnostics_win->win, "Diagnostics");
+    lv_win_set_header_height(diagnostics_win->win, LV_DPX(40));
+    lv_win_set_layout(diagnostics_win->win, LV_LAYOUT_COLUMN_MID);
+    lv_win_set_scrollbar_mode(diagnostics_win->win, LV_SCROLLBAR_MODE_OFF);
+
+    diagnostics_win->stats = lv_label_create(diagnostics_win->win, NULL);
+
+    lv_obj_t *close_btn = lv_btn_create(diagnostics_win->win, NULL);
+    diagnostics_win->close_btn = close_btn;
+    lv_obj_set_event_cb(close_btn, diagnostics_close_cb);
+    lv_obj_t *close_label = lv_label_create(close_btn, NULL);
+    lv_label_set_text(close_label, "Close");
+    lv_group_add_obj(group, close_btn);
+
+    update_stats();
+
+    diagnostics_win->update_task =
+        lv_task_create(update_stats_task, DIAGNOSTICS_UPDATE_INTERVAL, LV_TASK_PRIO_LOW, NULL);
+}
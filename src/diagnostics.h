@@ -0,0 +1,20 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Show a window with live capture and I2C bus counters (see
+ * hal_thermal_get_capture_stats() and hal_thermal_get_bus_stats()), e.g. to
+ * check the wiring to the sensor, and the latency until frames are shown.
+ * It's closed using its Close button.
+ */
+void diagnostics_show();
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*DIAGNOSTICS_H*/
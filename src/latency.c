@@ -0,0 +1,161 @@
+#include "latency.h"
+
+#include "hal_print.h"
+#include "hal_time.h"
+
+#include <lvgl.h>
+
+/**
+ * Number of frames to keep traces of, must be a power of 2.
+ */
+#define LATENCY_TRACE_SIZE (64)
+
+/**
+ * Print a report every this many frames that reached the display, 0 to disable.
+ */
+#ifndef LATENCY_REPORT_INTERVAL
+#define LATENCY_REPORT_INTERVAL 0
+#endif
+
+#define ALL_POINTS ((1 << LATENCY_POINT_COUNT) - 1)
+
+typedef struct
+{
+    uint32_t sequence;
+    uint32_t time_us[LATENCY_POINT_COUNT];
+    uint8_t points; // Bit mask of points passed
+} LatencyTrace;
+
+static const char *point_names[LATENCY_POINT_COUNT] = {
+    "data ready", "read", "radiometry", "colorize", "present", "flush",
+};
+
+static LatencyTrace traces[LATENCY_TRACE_SIZE];
+static uint32_t next_trace = 0;
+
+// Frame that was presented, but not yet flushed to the display
+static uint32_t flush_sequence = 0;
+
+static void (*ancestor_monitor_cb)(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
+
+static LatencyTrace *find_trace(uint32_t sequence)
+{
+    for (uint32_t i = 1; i <= LATENCY_TRACE_SIZE && i <= next_trace; i++)
+    {
+        LatencyTrace *trace = &traces[(next_trace - i) & (LATENCY_TRACE_SIZE - 1)];
+        if (trace->sequence == sequence)
+        {
+            return trace;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Called by LVGL after each display refresh, i.e. once all invalidated areas
+ * have been flushed.
+ */
+static void monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px)
+{
+    static uint32_t flushed_frames = 0;
+
+    if (ancestor_monitor_cb)
+    {
+        ancestor_monitor_cb(disp_drv, time, px);
+    }
+    if (flush_sequence == 0)
+    {
+        return;
+    }
+
+    latency_mark(flush_sequence, LATENCY_FLUSH);
+    flush_sequence = 0;
+
+    flushed_frames++;
+    if (LATENCY_REPORT_INTERVAL > 0 && flushed_frames >= LATENCY_REPORT_INTERVAL)
+    {
+        flushed_frames = 0;
+        latency_print_report();
+    }
+}
+
+void latency_init()
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    ancestor_monitor_cb = disp->driver.monitor_cb;
+    disp->driver.monitor_cb = monitor_cb;
+}
+
+void latency_start(uint32_t sequence, unsigned long data_ready_us, unsigned long read_us)
+{
+    LatencyTrace *trace = &traces[next_trace & (LATENCY_TRACE_SIZE - 1)];
+    next_trace++;
+    trace->sequence = sequence;
+    trace->time_us[LATENCY_DATA_READY] = data_ready_us;
+    trace->time_us[LATENCY_READ] = read_us;
+    trace->points = (1 << LATENCY_DATA_READY) | (1 << LATENCY_READ);
+}
+
+void latency_mark(uint32_t sequence, LatencyPoint point)
+{
+    LatencyTrace *trace = find_trace(sequence);
+    if (trace == NULL)
+    {
+        return;
+    }
+    trace->time_us[point] = hal_micros();
+    trace->points |= 1 << point;
+
+    if (point == LATENCY_PRESENT)
+    {
+        flush_sequence = sequence;
+    }
+}
+
+void latency_get_stats(LatencyPoint point, LatencyStats *stats)
+{
+    uint32_t latencies[LATENCY_TRACE_SIZE];
+    uint32_t count = 0;
+
+    // Insertion sort, there are only a few traces
+    for (int i = 0; i < LATENCY_TRACE_SIZE; i++)
+    {
+        const LatencyTrace *trace = &traces[i];
+        if (trace->points != ALL_POINTS)
+        {
+            continue;
+        }
+        uint32_t latency = trace->time_us[point] - trace->time_us[LATENCY_DATA_READY];
+        uint32_t j = count++;
+        while (j > 0 && latencies[j - 1] > latency)
+        {
+            latencies[j] = latencies[j - 1];
+            j--;
+        }
+        latencies[j] = latency;
+    }
+
+    stats->frames = count;
+    if (count == 0)
+    {
+        stats->p50_us = 0;
+        stats->p95_us = 0;
+        stats->max_us = 0;
+        return;
+    }
+    stats->p50_us = latencies[(count - 1) * 50 / 100];
+    stats->p95_us = latencies[(count - 1) * 95 / 100];
+    stats->max_us = latencies[count - 1];
+}
+
+void latency_print_report()
+{
+    for (int point = LATENCY_READ; point < LATENCY_POINT_COUNT; point++)
+    {
+        LatencyStats stats;
+        latency_get_stats(point, &stats);
+        hal_printf("latency to %s: p50=%.1fms p95=%.1fms max=%.1fms (%lu frames)\n", point_names[point],
+                   stats.p50_us / 1000.0f, stats.p95_us / 1000.0f, stats.max_us / 1000.0f,
+                   (unsigned long)stats.frames);
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * Points a frame passes on its way from the sensor to the display.
+ */
+typedef enum LatencyPoint
+{
+    LATENCY_DATA_READY = 0, // Polling the sensor's status showed new data
+    LATENCY_READ = 1,       // Reading the frame over I2C completed
+    LATENCY_RADIOMETRY = 2, // Temperatures calculated
+    LATENCY_COLORIZE = 3,   // Converted to colors (thermal_img_colorize())
+    LATENCY_PRESENT = 4,    // Image invalidated (thermal_img_present())
+    LATENCY_FLUSH = 5,      // Display refresh including the image completed
+    LATENCY_POINT_COUNT = 6,
+} LatencyPoint;
+
+/**
+ * Latency of a point relative to LATENCY_DATA_READY, over the traced frames
+ * that reached the display.
+ */
+typedef struct LatencyStats
+{
+    uint32_t frames; // Number of frames the statistics are based on
+    uint32_t p50_us;
+    uint32_t p95_us;
+    uint32_t max_us;
+} LatencyStats;
+
+/**
+ * Start tracing flushes of the default display, after it has been set up.
+ */
+void latency_init();
+
+/**
+ * Start tracing a frame, replacing the oldest trace when the trace ring is full.
+ * @param sequence Number identifying the frame (see PipelineBuffer).
+ * @param data_ready_us hal_micros() at LATENCY_DATA_READY.
+ * @param read_us hal_micros() at LATENCY_READ.
+ */
+void latency_start(uint32_t sequence, unsigned long data_ready_us, unsigned long read_us);
+
+/**
+ * Record that a traced frame passed a point (now). Frames that aren't being
+ * traced are ignored. LATENCY_FLUSH is recorded automatically, for the frame
+ * that passed LATENCY_PRESENT last.
+ */
+void latency_mark(uint32_t sequence, LatencyPoint point);
+
+void latency_get_stats(LatencyPoint point, LatencyStats *stats);
+
+/**
+ * Print p50, p95 and maximum latency of each point.
+ * With LATENCY_REPORT_INTERVAL > 0, this is done every that many frames that
+ * reached the display.
+ */
+void latency_print_report();
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LATENCY_H*/
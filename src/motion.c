@@ -0,0 +1,68 @@
+#include "motion.h"
+
+#include <math.h>
+
+/**
+ * Motion is detected when a pixel changes by more than this many times
+ * the average per-pixel change (i.e. noise).
+ */
+#define MOTION_THRESHOLD (8.0f)
+
+/**
+ * Speed (0.0 .. 1.0) at which the noise estimate follows the measured
+ * average change, when there's no motion.
+ */
+#define MOTION_NOISE_SPEED (0.05f)
+
+/**
+ * Lower bound of the noise estimate, so a perfectly still (e.g. simulated or
+ * replayed) scene doesn't flag the smallest change as motion. In the unit of
+ * the raw IR intensity (K^4, see MLX90641_GetImage()): about 0.01 °C for an
+ * object near room temperature.
+ */
+#define MOTION_NOISE_MIN (1.0e6f)
+
+static float previous[THERMAL_COLS * THERMAL_ROWS];
+static unsigned int frames = 0;
+static float noise = 0;
+
+void motion_reset()
+{
+    frames = 0;
+}
+
+bool motion_update(const float pixels[THERMAL_COLS * THERMAL_ROWS])
+{
+    float total_change = 0;
+    float max_change = 0;
+
+    for (int i = 0; i < THERMAL_COLS * THERMAL_ROWS; i++)
+    {
+        float change = fabsf(pixels[i] - previous[i]);
+        total_change += change;
+        if (change > max_change)
+        {
+            max_change = change;
+        }
+        previous[i] = pixels[i];
+    }
+
+    float average_change = total_change / (THERMAL_COLS * THERMAL_ROWS);
+    if (frames < 2)
+    {
+        // Need two frames for a first estimate of the noise
+        if (++frames == 2)
+        {
+            noise = fmaxf(average_change, MOTION_NOISE_MIN);
+        }
+        return false;
+    }
+
+    bool motion = max_change > MOTION_THRESHOLD * noise;
+    if (!motion)
+    {
+        noise = noise * (1.0f - MOTION_NOISE_SPEED) + average_change * MOTION_NOISE_SPEED;
+        noise = fmaxf(noise, MOTION_NOISE_MIN);
+    }
+    return motion;
+}
@@ -0,0 +1,30 @@
+#ifndef MOTION_H
+#define MOTION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hal_thermal.h"
+
+#include <stdbool.h>
+
+/**
+ * Forget previous frames, e.g. after switching to raw IR mode.
+ */
+void motion_reset();
+
+/**
+ * Detect motion by comparing raw IR frame (see THERMAL_MODE_RAW) to the
+ * previous one.
+ *
+ * @param pixels Raw IR intensity of each pixel.
+ * @returns true when motion was detected.
+ */
+bool motion_update(const float pixels[THERMAL_COLS * THERMAL_ROWS]);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*MOTION_H*/
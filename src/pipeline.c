@@ -0,0 +1,85 @@
+#include "pipeline.h"
+
+#include "hal_print.h"
+#include "hal_time.h"
+
+#include <string.h>
+
+/**
+ * Print stage timings every this many presented frames, 0 to disable.
+ */
+#ifndef PIPELINE_STATS_INTERVAL
+#define PIPELINE_STATS_INTERVAL 0
+#endif
+
+/**
+ * Maximum number of consecutive frames a stage skips.
+ */
+#define PIPELINE_MAX_SKIPS (1)
+
+static const char *stage_names[PIPELINE_STAGE_COUNT] = {
+    "acquire", "radiometry", "post-process", "colorize", "present",
+};
+
+static PipelineStageStats stats[PIPELINE_STAGE_COUNT];
+static uint8_t consecutive_skips[PIPELINE_STAGE_COUNT];
+static unsigned long start_times[PIPELINE_STAGE_COUNT];
+
+void pipeline_begin(PipelineStage stage)
+{
+    start_times[stage] = hal_micros();
+}
+
+void pipeline_end(PipelineStage stage)
+{
+    uint32_t elapsed = hal_micros() - start_times[stage];
+    PipelineStageStats *stage_stats = &stats[stage];
+    stage_stats->runs++;
+    stage_stats->total_us += elapsed;
+    if (elapsed > stage_stats->max_us)
+    {
+        stage_stats->max_us = elapsed;
+    }
+    consecutive_skips[stage] = 0;
+
+#if PIPELINE_STATS_INTERVAL > 0
+    if (stage == PIPELINE_PRESENT && stage_stats->runs >= PIPELINE_STATS_INTERVAL)
+    {
+        pipeline_print_stats();
+        pipeline_reset_stats();
+    }
+#endif
+}
+
+bool pipeline_skip(PipelineStage stage, bool newer_waiting)
+{
+    if (!newer_waiting || consecutive_skips[stage] >= PIPELINE_MAX_SKIPS)
+    {
+        return false;
+    }
+    consecutive_skips[stage]++;
+    stats[stage].skipped++;
+    return true;
+}
+
+void pipeline_get_stats(PipelineStage stage, PipelineStageStats *stage_stats)
+{
+    *stage_stats = stats[stage];
+}
+
+void pipeline_reset_stats()
+{
+    memset(stats, 0, sizeof(stats));
+}
+
+void pipeline_print_stats()
+{
+    for (int stage = 0; stage < PIPELINE_STAGE_COUNT; stage++)
+    {
+        const PipelineStageStats *stage_stats = &stats[stage];
+        hal_printf("%s: runs=%lu avg=%luus max=%luus skipped=%lu\n", stage_names[stage],
+                   (unsigned long)stage_stats->runs,
+                   stage_stats->runs > 0 ? (unsigned long)(stage_stats->total_us / stage_stats->runs) : 0UL,
+                   (unsigned long)stage_stats->max_us, (unsigned long)stage_stats->skipped);
+    }
+}
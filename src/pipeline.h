@@ -0,0 +1,120 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hal_thermal.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Stages a frame passes through, from the sensor to the display.
+ */
+typedef enum PipelineStage
+{
+    PIPELINE_ACQUIRE = 0,      // Take a captured frame from the sensor's queue
+    PIPELINE_RADIOMETRY = 1,   // Calculate temperatures
+    PIPELINE_POST_PROCESS = 2, // E.g. flip the image
+    PIPELINE_COLORIZE = 3,     // Convert temperatures to colors
+    PIPELINE_PRESENT = 4,      // Show the colorized frame (drawn by lv_task_handler())
+    PIPELINE_STAGE_COUNT = 5,
+} PipelineStage;
+
+/**
+ * Double buffer of pixels, to hand off frames between stages: a stage fills
+ * the back buffer, then publishes it as the front buffer, which the next
+ * stage reads. So the previous frame stays intact until a new one is
+ * complete.
+ */
+typedef struct PipelineBuffer
+{
+    float pixels[2][THERMAL_COLS * THERMAL_ROWS];
+    uint32_t sequence[2]; // Frame sequence number, 0 when empty
+    uint8_t front;
+} PipelineBuffer;
+
+/**
+ * Get the buffer to fill with the next frame.
+ */
+static inline float *pipeline_back(PipelineBuffer *buffer)
+{
+    return buffer->pixels[!buffer->front];
+}
+
+/**
+ * Make the frame in the back buffer the front one.
+ * @param sequence The frame's sequence number.
+ */
+static inline void pipeline_publish(PipelineBuffer *buffer, uint32_t sequence)
+{
+    buffer->front = !buffer->front;
+    buffer->sequence[buffer->front] = sequence;
+}
+
+/**
+ * Get the newest published frame.
+ */
+static inline const float *pipeline_front(const PipelineBuffer *buffer)
+{
+    return buffer->pixels[buffer->front];
+}
+
+/**
+ * Get the sequence number of the newest published frame, 0 when none.
+ */
+static inline uint32_t pipeline_front_sequence(const PipelineBuffer *buffer)
+{
+    return buffer->sequence[buffer->front];
+}
+
+/**
+ * Timing of a stage, since the last pipeline_reset_stats().
+ */
+typedef struct PipelineStageStats
+{
+    uint32_t runs;     // Frames processed
+    uint32_t skipped;  // Frames skipped, because a newer one was waiting
+    uint32_t total_us; // Total processing time
+    uint32_t max_us;   // Longest processing time
+} PipelineStageStats;
+
+/**
+ * Start timing a stage. A stage that turns out to have nothing to process
+ * just doesn't call pipeline_end().
+ */
+void pipeline_begin(PipelineStage stage);
+
+/**
+ * Finish timing a stage that processed a frame, since its last
+ * pipeline_begin().
+ * With PIPELINE_STATS_INTERVAL > 0, timings of all stages are printed (and
+ * reset) every that many presented frames.
+ */
+void pipeline_end(PipelineStage stage);
+
+/**
+ * Decide whether a stage should skip its frame, to continue with a newer
+ * one instead. A stage skips at most PIPELINE_MAX_SKIPS frames in a row, so
+ * frames keep coming through when the sensor is faster than the pipeline.
+ * @param newer_waiting Whether a newer frame is already waiting.
+ * @returns true when the frame should be skipped (which is counted).
+ */
+bool pipeline_skip(PipelineStage stage, bool newer_waiting);
+
+void pipeline_get_stats(PipelineStage stage, PipelineStageStats *stats);
+
+void pipeline_reset_stats();
+
+/**
+ * Print average and maximum time and skipped frames of each stage.
+ */
+void pipeline_print_stats();
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*PIPELINE_H*/
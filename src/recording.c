@@ -0,0 +1,161 @@
+#include "recording.h"
+
+#include "storage.h"
+
+#include "hal_flash.h"
+#include "hal_print.h"
+#include "hal_thermal.h"
+
+#include <string.h>
+
+/**
+ * Sector-aligned flash area holding the recording, after the storage slots.
+ */
+#define RECORDING_BASE_ADDRESS (0x00100000)
+#define RECORDING_SIZE (0x00200000)
+
+#define RECORDING_SECTOR_SIZE (4096)
+
+/**
+ * Magic number and version of the recording's index in storage.
+ */
+#define RECORDING_MAGIC (0x7ec0d1a6)
+#define RECORDING_VERSION (1)
+
+/**
+ * Number of recorded bytes printed per line by recording_dump().
+ */
+#define RECORDING_DUMP_LINE (32)
+
+typedef struct RecordingIndex
+{
+    uint32_t length; // Number of bytes recorded
+} RecordingIndex;
+
+static bool active = false;
+
+// Bytes written to flash so far
+static size_t written;
+
+// Flash can only be written per sector, so collect data until a sector is full
+static uint8_t sector[RECORDING_SECTOR_SIZE];
+static size_t buffered;
+
+static bool flush_sector()
+{
+    if (buffered == 0)
+    {
+        return true;
+    }
+
+    if (!hal_flash_write(RECORDING_BASE_ADDRESS + written, sector, buffered))
+    {
+        return false;
+    }
+    written += buffered;
+    buffered = 0;
+    return true;
+}
+
+static bool recording_write(const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+
+    if (written + buffered + len > RECORDING_SIZE)
+    {
+        hal_printf("Recording full\n");
+        return false;
+    }
+
+    while (len > 0)
+    {
+        size_t chunk = RECORDING_SECTOR_SIZE - buffered;
+        if (chunk > len)
+        {
+            chunk = len;
+        }
+        memcpy(sector + buffered, bytes, chunk);
+        buffered += chunk;
+        bytes += chunk;
+        len -= chunk;
+
+        if (buffered == RECORDING_SECTOR_SIZE && !flush_sector())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static const ThermalRecorder recorder = {
+    .write = recording_write,
+};
+
+bool recording_start()
+{
+    recording_stop();
+
+    written = 0;
+    buffered = 0;
+    active = hal_thermal_start_recording(&recorder);
+    return active;
+}
+
+bool recording_stop()
+{
+    if (!active)
+    {
+        return false;
+    }
+
+    hal_thermal_stop_recording();
+    active = false;
+
+    if (!flush_sector())
+    {
+        return false;
+    }
+
+    RecordingIndex index = {
+        .length = written,
+    };
+    return storage_write(STORAGE_SLOT_RECORDING, RECORDING_MAGIC, RECORDING_VERSION, &index, sizeof(index));
+}
+
+bool recording_is_active()
+{
+    return active;
+}
+
+void recording_dump()
+{
+    RecordingIndex index;
+    if (!storage_read(STORAGE_SLOT_RECORDING, RECORDING_MAGIC, RECORDING_VERSION, &index, sizeof(index)))
+    {
+        hal_printf("No recording found\n");
+        return;
+    }
+
+    hal_printf("----- BEGIN RECORDING (%lu bytes) -----\n", (unsigned long)index.length);
+    for (size_t offset = 0; offset < index.length; offset += RECORDING_DUMP_LINE)
+    {
+        uint8_t data[RECORDING_DUMP_LINE];
+        size_t len = index.length - offset < RECORDING_DUMP_LINE ? index.length - offset : RECORDING_DUMP_LINE;
+        if (!hal_flash_read(RECORDING_BASE_ADDRESS + offset, data, len))
+        {
+            hal_printf("Reading recording failed\n");
+            break;
+        }
+
+        static const char digits[] = "0123456789abcdef";
+        char line[2 * RECORDING_DUMP_LINE + 1];
+        for (size_t i = 0; i < len; i++)
+        {
+            line[2 * i] = digits[data[i] >> 4];
+            line[2 * i + 1] = digits[data[i] & 0x0f];
+        }
+        line[2 * len] = '\0';
+        hal_printf("%s\n", line);
+    }
+    hal_printf("----- END RECORDING -----\n");
+}
@@ -0,0 +1,34 @@
+#ifndef RECORDING_H
+#define RECORDING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+/**
+ * Start recording raw sensor data to flash, replacing any previous recording.
+ * @returns true when recording was started, false otherwise.
+ */
+bool recording_start();
+
+/**
+ * Stop recording, and store what was recorded so far.
+ * @returns true when recording was stored, false otherwise.
+ */
+bool recording_stop();
+
+bool recording_is_active();
+
+/**
+ * Print the stored recording as hex, to be converted back to a file on the
+ * host (e.g. using `xxd -r -p`).
+ */
+void recording_dump();
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*RECORDING_H*/
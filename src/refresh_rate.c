@@ -0,0 +1,83 @@
+#include "refresh_rate.h"
+
+#include "hal_time.h"
+
+#include <math.h>
+
+/**
+ * Range of rates used in automatic mode.
+ */
+#define REFRESH_RATE_MIN THERMAL_REFRESH_2HZ
+#define REFRESH_RATE_MAX THERMAL_REFRESH_32HZ
+
+/**
+ * Rate to jump to (at least) as soon as the scene starts changing.
+ */
+#define REFRESH_RATE_SCANNING THERMAL_REFRESH_16HZ
+
+/**
+ * A pixel has changed when its temperature differs by more than this
+ * many degrees from the previous frame, well above the sensor's noise
+ * (~0.5 degrees at 32 Hz).
+ */
+#define REFRESH_PIXEL_THRESHOLD (1.5f)
+
+/**
+ * The scene has changed when at least this many pixels have changed.
+ */
+#define REFRESH_CHANGED_PIXELS (8)
+
+/**
+ * Time (in milliseconds) the scene needs to be static before going to the
+ * next lower rate.
+ */
+#define REFRESH_HOLD_TIME (3000)
+
+static float previous[THERMAL_COLS * THERMAL_ROWS];
+static bool have_previous = false;
+static unsigned long last_change = 0;
+
+void refresh_rate_reset()
+{
+    have_previous = false;
+}
+
+ThermalRefreshRate refresh_rate_update(const float pixels[THERMAL_COLS * THERMAL_ROWS], ThermalRefreshRate rate)
+{
+    int changed_pixels = 0;
+    for (int i = 0; i < THERMAL_COLS * THERMAL_ROWS; i++)
+    {
+        if (fabsf(pixels[i] - previous[i]) > REFRESH_PIXEL_THRESHOLD)
+        {
+            changed_pixels++;
+        }
+        previous[i] = pixels[i];
+    }
+
+    unsigned long now = hal_millis();
+    if (!have_previous)
+    {
+        have_previous = true;
+        last_change = now;
+        return rate < REFRESH_RATE_MIN ? REFRESH_RATE_MIN : rate > REFRESH_RATE_MAX ? REFRESH_RATE_MAX : rate;
+    }
+
+    if (changed_pixels >= REFRESH_CHANGED_PIXELS)
+    {
+        last_change = now;
+        if (rate < REFRESH_RATE_SCANNING)
+        {
+            return REFRESH_RATE_SCANNING;
+        }
+        return rate < REFRESH_RATE_MAX ? rate + 1 : REFRESH_RATE_MAX;
+    }
+
+    if (now - last_change >= REFRESH_HOLD_TIME && rate > REFRESH_RATE_MIN)
+    {
+        // Restart hold time, to step down one rate at a time
+        last_change = now;
+        return rate - 1;
+    }
+
+    return rate;
+}
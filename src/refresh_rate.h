@@ -0,0 +1,31 @@
+#ifndef REFRESH_RATE_H
+#define REFRESH_RATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hal_thermal.h"
+
+/**
+ * Forget previous frames, e.g. after switching to automatic refresh rate.
+ */
+void refresh_rate_reset();
+
+/**
+ * Determine refresh rate to use in automatic mode, by comparing the frame to
+ * the previous one: use a high rate while the scene changes (e.g. when
+ * scanning around), and gradually lower it when the scene is static, to
+ * reduce noise and power usage.
+ *
+ * @param pixels Temperature of each pixel.
+ * @param rate Refresh rate currently in use.
+ * @returns Refresh rate to use.
+ */
+ThermalRefreshRate refresh_rate_update(const float pixels[THERMAL_COLS * THERMAL_ROWS], ThermalRefreshRate rate);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*REFRESH_RATE_H*/
@@ -0,0 +1,147 @@
+#include "resolution_benchmark.h"
+
+#include "hal_print.h"
+#include "hal_time.h"
+
+#include <math.h>
+
+/**
+ * Frames to ignore after switching resolution, e.g. while the sub-page
+ * fusion adapts to the new noise level.
+ */
+#define BENCHMARK_SETTLE_FRAMES (4)
+
+/**
+ * Frames to measure per resolution and refresh rate.
+ */
+#define BENCHMARK_FRAMES (16)
+
+/**
+ * Refresh rates to measure at each resolution. Higher rates are noisier, and
+ * the frame rate shows which ones the device can't keep up with.
+ */
+#define BENCHMARK_MIN_RATE THERMAL_REFRESH_2HZ
+#define BENCHMARK_MAX_RATE THERMAL_REFRESH_16HZ
+
+static bool active = false;
+static int resolution;
+static int rate;
+static int frames;
+static unsigned long start_time;
+
+// Per-pixel sums of temperature (relative to the first frame, to reduce
+// rounding errors) and its square
+static float first[THERMAL_COLS * THERMAL_ROWS];
+static float sum[THERMAL_COLS * THERMAL_ROWS];
+static float sum_squares[THERMAL_COLS * THERMAL_ROWS];
+
+static bool start_step(int new_resolution, int new_rate)
+{
+    frames = -BENCHMARK_SETTLE_FRAMES;
+    if (new_resolution != resolution && !hal_thermal_set_resolution(new_resolution))
+    {
+        hal_printf("ERROR: Setting resolution failed.\n");
+        return false;
+    }
+    resolution = new_resolution;
+    if (new_rate != rate && !hal_thermal_set_refresh_rate(new_rate))
+    {
+        hal_printf("ERROR: Setting refresh rate failed.\n");
+        return false;
+    }
+    rate = new_rate;
+    return true;
+}
+
+/**
+ * Start measuring the next refresh rate, or the next resolution after the
+ * last rate.
+ * @returns false when all have been measured, or on error.
+ */
+static bool next_step()
+{
+    if (rate < BENCHMARK_MAX_RATE)
+    {
+        return start_step(resolution, rate + 1);
+    }
+    if (resolution < THERMAL_RESOLUTION_19BIT)
+    {
+        return start_step(resolution + 1, BENCHMARK_MIN_RATE);
+    }
+    return false;
+}
+
+static void report()
+{
+    float noise = 0;
+    for (int i = 0; i < THERMAL_COLS * THERMAL_ROWS; i++)
+    {
+        float mean = sum[i] / frames;
+        float variance = (sum_squares[i] - frames * mean * mean) / (frames - 1);
+        noise += variance > 0 ? sqrtf(variance) : 0;
+    }
+    noise /= THERMAL_COLS * THERMAL_ROWS;
+
+    unsigned long elapsed = hal_millis() - start_time;
+    hal_printf("%d bit, %d Hz: noise %.3f degC, %.1f frames/s\n", 16 + resolution, 1 << (rate - THERMAL_REFRESH_1HZ),
+               noise, elapsed > 0 ? (frames - 1) * 1000.0f / elapsed : 0.0f);
+}
+
+void resolution_benchmark_start()
+{
+    hal_printf("Resolution benchmark started, keep the scene static.\n");
+    // Unknown, so both are set
+    resolution = -1;
+    rate = -1;
+    active = start_step(THERMAL_RESOLUTION_16BIT, BENCHMARK_MIN_RATE);
+}
+
+bool resolution_benchmark_is_active()
+{
+    return active;
+}
+
+bool resolution_benchmark_update(const float pixels[THERMAL_COLS * THERMAL_ROWS])
+{
+    if (!active)
+    {
+        return false;
+    }
+
+    frames++;
+    if (frames <= 0)
+    {
+        return true;
+    }
+
+    if (frames == 1)
+    {
+        start_time = hal_millis();
+        for (int i = 0; i < THERMAL_COLS * THERMAL_ROWS; i++)
+        {
+            first[i] = pixels[i];
+            sum[i] = 0;
+            sum_squares[i] = 0;
+        }
+    }
+
+    for (int i = 0; i < THERMAL_COLS * THERMAL_ROWS; i++)
+    {
+        float delta = pixels[i] - first[i];
+        sum[i] += delta;
+        sum_squares[i] += delta * delta;
+    }
+
+    if (frames < BENCHMARK_FRAMES)
+    {
+        return true;
+    }
+
+    report();
+    if (!next_step())
+    {
+        hal_printf("Resolution benchmark finished.\n");
+        active = false;
+    }
+    return active;
+}
@@ -0,0 +1,36 @@
+#ifndef RESOLUTION_BENCHMARK_H
+#define RESOLUTION_BENCHMARK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hal_thermal.h"
+
+#include <stdbool.h>
+
+/**
+ * Measure each ADC resolution at several refresh rates in turn, and print
+ * the noise (standard deviation of each pixel over time, averaged over all
+ * pixels) and the frame rate achieved. Point the camera at a static scene
+ * while it runs.
+ * The benchmark sets the resolution and refresh rate of the sensor while
+ * active, the current noise reduction setting is used.
+ */
+void resolution_benchmark_start();
+
+bool resolution_benchmark_is_active();
+
+/**
+ * Process a new frame while the benchmark is active.
+ * @param pixels Temperature of each pixel.
+ * @returns true when the benchmark is still active, false when it's finished
+ *      (and the resolution and refresh rate should be restored).
+ */
+bool resolution_benchmark_update(const float pixels[THERMAL_COLS * THERMAL_ROWS]);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*RESOLUTION_BENCHMARK_H*/
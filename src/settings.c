@@ -2,9 +2,14 @@
 
 #include "focus.h"
 #include "hal_print.h"
+#include "hal_thermal.h"
 #include "storage.h"
 #include <lvgl.h>
 
+// Options of the I2C clock dropdown
+static const uint16_t bus_clocks[] = {THERMAL_BUS_CLOCK_AUTO, 1000, 400, 100};
+#define BUS_CLOCK_COUNT (sizeof(bus_clocks) / sizeof(bus_clocks[0]))
+
 typedef struct
 {
     Settings *settings;
@@ -20,6 +25,13 @@ typedef struct
     lv_obj_t *min_temp;
     lv_obj_t *flip_hor;
     lv_obj_t *flip_ver;
+    lv_obj_t *refresh_rate;
+    lv_obj_t *fusion;
+    lv_obj_t *resolution;
+    lv_obj_t *capture;
+    lv_obj_t *bus_clock;
+    lv_obj_t *benchmark_btn;
+    lv_obj_t *diagnostics_btn;
     lv_obj_t *close_btn;
     lv_obj_t *save_btn;
 
@@ -29,7 +41,7 @@ typedef struct
 
 static SettingsWindow *settings_win;
 
-static void settings_close()
+static void settings_close(SettingsAction action)
 {
     focus_pop_group();
     lv_obj_del(settings_win->win);
@@ -40,7 +52,7 @@ static void settings_close()
 
     if (closed_cb)
     {
-        closed_cb();
+        closed_cb(action);
     }
 }
 
@@ -48,7 +60,31 @@ static void settings_close_cb(lv_obj_t *obj, lv_event_t event)
 {
     if (event == LV_EVENT_CLICKED || event == LV_EVENT_CANCEL)
     {
-        settings_close();
+        settings_close(SETTINGS_ACTION_NONE);
+    }
+}
+
+static void benchmark_cb(lv_obj_t *obj, lv_event_t event)
+{
+    if (event == LV_EVENT_CLICKED)
+    {
+        settings_close(SETTINGS_ACTION_RESOLUTION_BENCHMARK);
+    }
+    else if (event == LV_EVENT_CANCEL)
+    {
+        settings_close(SETTINGS_ACTION_NONE);
+    }
+}
+
+static void diagnostics_cb(lv_obj_t *obj, lv_event_t event)
+{
+    if (event == LV_EVENT_CLICKED)
+    {
+        settings_close(SETTINGS_ACTION_DIAGNOSTICS);
+    }
+    else if (event == LV_EVENT_CANCEL)
+    {
+        settings_close(SETTINGS_ACTION_NONE);
     }
 }
 
@@ -69,7 +105,7 @@ static void save_defaults_cb(lv_obj_t *obj, lv_event_t event)
 {
     if (event == LV_EVENT_CANCEL)
     {
-        settings_close();
+        settings_close(SETTINGS_ACTION_NONE);
     }
     else if (event != LV_EVENT_CLICKED)
     {
@@ -77,7 +113,8 @@ static void save_defaults_cb(lv_obj_t *obj, lv_event_t event)
     }
 
     bool ok = true;
-    if (!storage_write(SETTINGS_MAGIC, SETTINGS_VERSION, settings_win->settings, sizeof(Settings)))
+    if (!storage_write(STORAGE_SLOT_SETTINGS, SETTINGS_MAGIC, SETTINGS_VERSION, settings_win->settings,
+                       sizeof(Settings)))
     {
         // Recompile with -DSTORAGE_DEBUG=1 for detailed info
         hal_printf("ERROR: Saving settings failed.\n");
@@ -85,7 +122,8 @@ static void save_defaults_cb(lv_obj_t *obj, lv_event_t event)
     }
 
     Settings temp_settings;
-    if (!storage_read(SETTINGS_MAGIC, SETTINGS_VERSION, &temp_settings, sizeof(Settings)) ||
+    if (!storage_read(STORAGE_SLOT_SETTINGS, SETTINGS_MAGIC, SETTINGS_VERSION, &temp_settings,
+                      sizeof(Settings)) ||
         memcmp(settings_win->settings, &temp_settings, sizeof(Settings)) != 0)
     {
         hal_printf("ERROR: Settings verify failed.\n");
@@ -113,6 +151,18 @@ static void activate_textarea(lv_obj_t *area, lv_obj_t *focused, bool editing)
     }
 }
 
+static void activate_dropdown(lv_obj_t *dropdown, lv_obj_t *focused, bool editing)
+{
+    if (focused == dropdown && editing)
+    {
+        lv_dropdown_open(dropdown);
+    }
+    else
+    {
+        lv_dropdown_close(dropdown);
+    }
+}
+
 static void settings_focus_cb(lv_group_t *group)
 {
     lv_obj_t *focused = lv_group_get_focused(group);
@@ -140,6 +190,19 @@ static void settings_focus_cb(lv_group_t *group)
     activate_textarea(settings_win->reflected, focused, editing);
     activate_textarea(settings_win->max_temp, focused, editing);
     activate_textarea(settings_win->min_temp, focused, editing);
+    activate_dropdown(settings_win->refresh_rate, focused, editing);
+    activate_dropdown(settings_win->fusion, focused, editing);
+    activate_dropdown(settings_win->resolution, focused, editing);
+    activate_dropdown(settings_win->capture, focused, editing);
+    activate_dropdown(settings_win->bus_clock, focused, editing);
+
+    // Dropdown's selection is applied when leaving edit mode
+    uint16_t selected = lv_dropdown_get_selected(settings_win->refresh_rate);
+    settings_win->settings->refresh_rate = selected == 0 ? SETTINGS_REFRESH_AUTO : selected - 1;
+    settings_win->settings->fusion = lv_dropdown_get_selected(settings_win->fusion);
+    settings_win->settings->resolution = lv_dropdown_get_selected(settings_win->resolution);
+    settings_win->settings->capture = lv_dropdown_get_selected(settings_win->capture);
+    settings_win->settings->bus_clock = bus_clocks[lv_dropdown_get_selected(settings_win->bus_clock)];
 }
 
 static void configure_focus_group()
@@ -162,6 +225,13 @@ static void configure_focus_group()
     }
     lv_group_add_obj(group, settings_win->flip_hor);
     lv_group_add_obj(group, settings_win->flip_ver);
+    lv_group_add_obj(group, settings_win->refresh_rate);
+    lv_group_add_obj(group, settings_win->fusion);
+    lv_group_add_obj(group, settings_win->resolution);
+    lv_group_add_obj(group, settings_win->capture);
+    lv_group_add_obj(group, settings_win->bus_clock);
+    lv_group_add_obj(group, settings_win->benchmark_btn);
+    lv_group_add_obj(group, settings_win->diagnostics_btn);
     lv_group_add_obj(group, settings_win->close_btn);
     lv_group_add_obj(group, settings_win->save_btn);
 
@@ -230,7 +300,7 @@ static void checkbox_event_cb(lv_obj_t *checkbox, lv_event_t event)
     }
     else if (event == LV_EVENT_CANCEL)
     {
-        settings_close();
+        settings_close(SETTINGS_ACTION_NONE);
     }
 }
 
@@ -278,7 +348,7 @@ static void spinbox_event_cb(lv_obj_t *spinbox, lv_event_t event)
     }
     else if (event == LV_EVENT_CANCEL)
     {
-        settings_close();
+        settings_close(SETTINGS_ACTION_NONE);
     }
 }
 
@@ -407,6 +477,98 @@ void settings_show(Settings *settings, SettingsClosedCallback closed_cb)
     lv_obj_set_width_margin(label, lv_obj_get_width_fit(row) - lv_obj_get_width_margin(checkbox) - padding);
     lv_label_set_text(label, "Flip vertically");
 
+    // Refresh rate, first option is 'auto', others are ThermalRefreshRate + 1
+    row = lv_cont_create(settings_win->win, row);
+    label = lv_label_create(row, label);
+    lv_obj_t *dropdown = lv_dropdown_create(row, NULL);
+    settings_win->refresh_rate = dropdown;
+    lv_dropdown_set_options(dropdown, "Auto\n0.5 Hz\n1 Hz\n2 Hz\n4 Hz\n8 Hz\n16 Hz\n32 Hz\n64 Hz");
+    lv_dropdown_set_max_height(dropdown, LV_DPX(160));
+    lv_obj_set_width(dropdown, LV_DPX(100));
+    uint8_t refresh_rate = settings_win->settings->refresh_rate;
+    lv_dropdown_set_selected(dropdown, refresh_rate == SETTINGS_REFRESH_AUTO ? 0 : refresh_rate + 1);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+    lv_obj_set_width_margin(label, lv_obj_get_width_fit(row) - lv_obj_get_width_margin(dropdown) - padding);
+    lv_label_set_text(label, "Refresh rate");
+
+    // Noise reduction, options match ThermalFusion
+    row = lv_cont_create(settings_win->win, row);
+    label = lv_label_create(row, label);
+    dropdown = lv_dropdown_create(row, dropdown);
+    settings_win->fusion = dropdown;
+    lv_dropdown_set_options(dropdown, "Off\nAverage\nMotion-aware");
+    lv_dropdown_set_selected(dropdown, settings_win->settings->fusion);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+    lv_obj_set_width_margin(label, lv_obj_get_width_fit(row) - lv_obj_get_width_margin(dropdown) - padding);
+    lv_label_set_text(label, "Noise reduction");
+
+    // ADC resolution, options match ThermalResolution
+    row = lv_cont_create(settings_win->win, row);
+    label = lv_label_create(row, label);
+    dropdown = lv_dropdown_create(row, dropdown);
+    settings_win->resolution = dropdown;
+    lv_dropdown_set_options(dropdown, "16 bit\n17 bit\n18 bit\n19 bit");
+    lv_dropdown_set_selected(dropdown, settings_win->settings->resolution);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+    lv_obj_set_width_margin(label, lv_obj_get_width_fit(row) - lv_obj_get_width_margin(dropdown) - padding);
+    lv_label_set_text(label, "ADC resolution");
+
+    // Capture, options match SettingsCapture
+    row = lv_cont_create(settings_win->win, row);
+    label = lv_label_create(row, label);
+    dropdown = lv_dropdown_create(row, dropdown);
+    settings_win->capture = dropdown;
+    lv_dropdown_set_options(dropdown, "Continuous\nOn key press\nEvery 10 s\nEvery 60 s");
+    lv_dropdown_set_selected(dropdown, settings_win->settings->capture);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+    lv_obj_set_width_margin(label, lv_obj_get_width_fit(row) - lv_obj_get_width_margin(dropdown) - padding);
+    lv_label_set_text(label, "Capture");
+
+    // I2C clock, options match bus_clocks
+    row = lv_cont_create(settings_win->win, row);
+    label = lv_label_create(row, label);
+    dropdown = lv_dropdown_create(row, dropdown);
+    settings_win->bus_clock = dropdown;
+    lv_dropdown_set_options(dropdown, "Auto\n1 MHz\n400 kHz\n100 kHz");
+    uint16_t bus_clock_index = 0;
+    for (uint16_t i = 0; i < BUS_CLOCK_COUNT; i++)
+    {
+        if (bus_clocks[i] == settings_win->settings->bus_clock)
+        {
+            bus_clock_index = i;
+        }
+    }
+    lv_dropdown_set_selected(dropdown, bus_clock_index);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+    lv_obj_set_width_margin(label, lv_obj_get_width_fit(row) - lv_obj_get_width_margin(dropdown) - padding);
+    lv_label_set_text(label, "I2C clock");
+
+    // Resolution benchmark
+    row = lv_cont_create(settings_win->win, row);
+    label = lv_label_create(row, label);
+    lv_obj_t *benchmark_btn = lv_btn_create(row, NULL);
+    settings_win->benchmark_btn = benchmark_btn;
+    lv_obj_set_event_cb(benchmark_btn, benchmark_cb);
+    lv_obj_t *benchmark_label = lv_label_create(benchmark_btn, NULL);
+    lv_label_set_text(benchmark_label, "Start");
+    lv_btn_set_fit2(benchmark_btn, LV_FIT_TIGHT, LV_FIT_TIGHT);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+    lv_obj_set_width_margin(label, lv_obj_get_width_fit(row) - lv_obj_get_width_margin(benchmark_btn) - padding);
+    lv_label_set_text(label, "Resolution benchmark");
+
+    // Diagnostics
+    row = lv_cont_create(settings_win->win, row);
+    label = lv_label_create(row, label);
+    lv_obj_t *diagnostics_btn = lv_btn_create(row, NULL);
+    settings_win->diagnostics_btn = diagnostics_btn;
+    lv_obj_set_event_cb(diagnostics_btn, diagnostics_cb);
+    lv_obj_t *diagnostics_label = lv_label_create(diagnostics_btn, NULL);
+    lv_label_set_text(diagnostics_label, "Show");
+    lv_btn_set_fit2(diagnostics_btn, LV_FIT_TIGHT, LV_FIT_TIGHT);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+    lv_obj_set_width_margin(label, lv_obj_get_width_fit(row) - lv_obj_get_width_margin(diagnostics_btn) - padding);
+    lv_label_set_text(label, "Diagnostics");
+
     // Close
     lv_obj_t *close_btn = lv_btn_create(settings_win->win, NULL);
     settings_win->close_btn = close_btn;
@@ -17,7 +17,25 @@ extern "C" {
  * Current settings version. Increment for every change to the
  * struct below.
  */
-#define SETTINGS_VERSION (3)
+#define SETTINGS_VERSION (8)
+
+/**
+ * Value of `refresh_rate` to automatically adapt the sensor's refresh rate
+ * to the amount of change in the scene.
+ */
+#define SETTINGS_REFRESH_AUTO (0xff)
+
+/**
+ * When frames are captured. Except for continuous capture, the sensor is
+ * idle in between (see THERMAL_CAPTURE_STEP).
+ */
+typedef enum SettingsCapture
+{
+    SETTINGS_CAPTURE_CONTINUOUS = 0,
+    SETTINGS_CAPTURE_KEY = 1, // On pressing the 'B' key
+    SETTINGS_CAPTURE_10S = 2, // Every 10 seconds
+    SETTINGS_CAPTURE_60S = 3, // Every 60 seconds
+} SettingsCapture;
 
 typedef struct
 {
@@ -75,9 +93,47 @@ typedef struct
      * Flip image vertically.
      */
     bool flip_ver;
+
+    /**
+     * Sensor refresh rate (a ThermalRefreshRate), or
+     * SETTINGS_REFRESH_AUTO.
+     */
+    uint8_t refresh_rate;
+
+    /**
+     * How to combine the sensor's sub-pages to reduce noise
+     * (a ThermalFusion).
+     */
+    uint8_t fusion;
+
+    /**
+     * Sensor ADC resolution (a ThermalResolution).
+     */
+    uint8_t resolution;
+
+    /**
+     * When to capture frames (a SettingsCapture).
+     */
+    uint8_t capture;
+
+    /**
+     * Clock of the sensor's I2C bus in kHz, or THERMAL_BUS_CLOCK_AUTO
+     * to lower it automatically when errors occur.
+     */
+    uint16_t bus_clock;
 } Settings;
 
-typedef void (*SettingsClosedCallback)(void);
+/**
+ * Action requested by the user when closing the settings window.
+ */
+typedef enum SettingsAction
+{
+    SETTINGS_ACTION_NONE = 0,
+    SETTINGS_ACTION_RESOLUTION_BENCHMARK = 1,
+    SETTINGS_ACTION_DIAGNOSTICS = 2,
+} SettingsAction;
+
+typedef void (*SettingsClosedCallback)(SettingsAction action);
 
 void settings_show(Settings *settings, SettingsClosedCallback closed_cb);
 
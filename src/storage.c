@@ -21,6 +21,16 @@
  */
 #define STORAGE_BASE_ADDRESS (0x00000000)
 
+/**
+ * Sector-aligned size of each slot, including header
+ */
+#define STORAGE_SLOT_SIZE (0x00010000)
+
+/**
+ * Flash sector size, writes are done one sector at a time
+ */
+#define STORAGE_SECTOR_SIZE (4096)
+
 typedef struct StorageHeader
 {
     uint32_t magic;
@@ -31,18 +41,29 @@ typedef struct StorageHeader
 
 static uint32_t crc32(const uint8_t *data, size_t size);
 
-bool storage_read(uint32_t magic, uint32_t version, void *data, size_t len)
+/**
+ * Sector being written, as hal_flash_write() erases each sector it writes to
+ * (so the header and data can't be written separately).
+ */
+static uint8_t sector_buffer[STORAGE_SECTOR_SIZE];
+
+static size_t slot_address(StorageSlot slot)
+{
+    return STORAGE_BASE_ADDRESS + slot * STORAGE_SLOT_SIZE;
+}
+
+bool storage_read(StorageSlot slot, uint32_t magic, uint32_t version, void *data, size_t len)
 {
     StorageHeader header;
 
-    if (!hal_flash_read(STORAGE_BASE_ADDRESS, &header, sizeof(header)))
+    if (!hal_flash_read(slot_address(slot), &header, sizeof(header)))
     {
         STORAGE_PRINTF("storage_read(): read header failed\n");
         return false;
     }
 
-    STORAGE_PRINTF("storage_read(): magic=0x%08x version=0x%08x chk=0x%08x len=%u\n", header.magic, header.version,
-                   header.checksum, header.len);
+    STORAGE_PRINTF("storage_read(): slot=%u magic=0x%08x version=0x%08x chk=0x%08x len=%u\n", slot, header.magic,
+                   header.version, header.checksum, header.len);
 
     if (header.magic != magic || header.version != version || header.len != len)
     {
@@ -50,7 +71,7 @@ bool storage_read(uint32_t magic, uint32_t version, void *data, size_t len)
         return false;
     }
 
-    if (!hal_flash_read(STORAGE_BASE_ADDRESS + sizeof(header), data, len))
+    if (!hal_flash_read(slot_address(slot) + sizeof(header), data, len))
     {
         STORAGE_PRINTF("storage_read(): read data failed\n");
         return false;
@@ -68,23 +89,48 @@ bool storage_read(uint32_t magic, uint32_t version, void *data, size_t len)
     return true;
 }
 
-bool storage_write(uint32_t magic, uint32_t version, const void *data, size_t len)
+bool storage_write(StorageSlot slot, uint32_t magic, uint32_t version, const void *data, size_t len)
 {
     StorageHeader header;
-    uint8_t buffer[sizeof(header) + len];
+
+    if (sizeof(header) + len > STORAGE_SLOT_SIZE)
+    {
+        STORAGE_PRINTF("storage_write(): data too large for slot\n");
+        return false;
+    }
 
     header.magic = magic;
     header.version = version;
     header.checksum = crc32(data, len);
     header.len = len;
 
-    STORAGE_PRINTF("storage_write(): magic=0x%08x version=0x%08x chk=0x%08x len=%u\n", header.magic, header.version,
-                   header.checksum, header.len);
+    STORAGE_PRINTF("storage_write(): slot=%u magic=0x%08x version=0x%08x chk=0x%08x len=%u\n", slot, header.magic,
+                   header.version, header.checksum, header.len);
 
-    memmove(buffer, &header, sizeof(header));
-    memmove(buffer + sizeof(header), data, len);
+    // Write the header followed by the data, a sector at a time
+    size_t address = slot_address(slot);
+    const uint8_t *remaining = data;
+    size_t remaining_len = len;
+    size_t used = sizeof(header);
+    memmove(sector_buffer, &header, sizeof(header));
 
-    bool ok = hal_flash_write(STORAGE_BASE_ADDRESS, buffer, sizeof(buffer));
+    bool ok;
+    do
+    {
+        size_t chunk = STORAGE_SECTOR_SIZE - used;
+        if (chunk > remaining_len)
+        {
+            chunk = remaining_len;
+        }
+        memmove(sector_buffer + used, remaining, chunk);
+        remaining += chunk;
+        remaining_len -= chunk;
+        used += chunk;
+
+        ok = hal_flash_write(address, sector_buffer, used);
+        address += STORAGE_SECTOR_SIZE;
+        used = 0;
+    } while (ok && remaining_len > 0);
 
     if (!ok)
     {
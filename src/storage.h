@@ -9,8 +9,18 @@ extern "C" {
 #include <stddef.h>
 #include <stdint.h>
 
-bool storage_read(uint32_t magic, uint32_t version, void *data, size_t len);
-bool storage_write(uint32_t magic, uint32_t version, const void *data, size_t len);
+/**
+ * Independent storage areas, each holding one item.
+ */
+typedef enum StorageSlot
+{
+    STORAGE_SLOT_SETTINGS = 0,
+    STORAGE_SLOT_CALIBRATION = 1,
+    STORAGE_SLOT_RECORDING = 2, // Index of recording.c, the recording itself is stored separately
+} StorageSlot;
+
+bool storage_read(StorageSlot slot, uint32_t magic, uint32_t version, void *data, size_t len);
+bool storage_write(StorageSlot slot, uint32_t magic, uint32_t version, const void *data, size_t len);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -32,13 +32,30 @@
 
 static lv_design_cb_t thermal_img_ancestor_design;
 static lv_obj_t *thermal_img_obj;
-static uint8_t thermal_pixels[THERMAL_ROWS * THERMAL_COLS];
+
+/**
+ * Colorized frames: the front one is drawn, the back one is filled by
+ * thermal_img_colorize() until thermal_img_present() swaps them.
+ */
+typedef struct
+{
+    uint8_t pixels[THERMAL_ROWS * THERMAL_COLS];
+    float min_temp;
+    float max_temp;
+    float center_temp;
+    float scale_min_temp; // Color scale range the pixels were colorized with
+    float scale_max_temp;
+} ThermalImgFrame;
+
+static ThermalImgFrame frames[2];
+static ThermalImgFrame *front_frame = &frames[0];
+static ThermalImgFrame *back_frame = &frames[1];
+static bool back_ready = false;
 
 static lv_color_t colorMap[256];
 
 /**
- * Cache of min/max temperature ranges for color scale.
- * Automatically updated from settings if needed.
+ * Color scale range shown by the legend, i.e. of the presented frame.
  */
 static float thermal_min_temp = 25.0;
 static float thermal_max_temp = 38.0;
@@ -48,6 +65,7 @@ static lv_obj_t *legend_max_label;
 static lv_obj_t *measurement_min_label;
 static lv_obj_t *measurement_max_label;
 static lv_obj_t *measurement_center_label;
+static lv_obj_t *status_label;
 
 static lv_design_res_t thermal_img_design(lv_obj_t *img, const lv_area_t *clip_area, lv_design_mode_t mode)
 {
@@ -104,7 +122,7 @@ static lv_design_res_t thermal_img_design(lv_obj_t *img, const lv_area_t *clip_a
                 lv_coord_t x1 = x * ZOOM + img->coords.x1;
                 lv_area_t coords;
                 lv_area_set(&coords, x1, y1, x1 + ZOOM - 1, y1 + ZOOM - 1);
-                draw_dsc.bg_color = colorMap[thermal_pixels[y_index + x]];
+                draw_dsc.bg_color = colorMap[front_frame->pixels[y_index + x]];
                 lv_draw_rect(&coords, clip_area, &draw_dsc);
             }
         }
@@ -194,6 +212,24 @@ void thermal_img_init()
     lv_label_set_recolor(measurement_max_label, true);
     lv_label_set_text_fmt(measurement_max_label, LV_SYMBOL_UP " 000.0");
     lv_obj_align(measurement_max_label, thermal_img_obj, LV_ALIGN_OUT_BOTTOM_RIGHT, 2, 2);
+
+    // Status message on top of the image, e.g. while the camera isn't ready
+    status_label = lv_label_create(thermal_img_obj, NULL);
+    lv_obj_set_auto_realign(status_label, true);
+    lv_obj_align(status_label, NULL, LV_ALIGN_CENTER, 0, 0);
+    lv_label_set_align(status_label, LV_LABEL_ALIGN_CENTER);
+    lv_obj_set_hidden(status_label, true);
+}
+
+void thermal_img_set_status(const char *status)
+{
+    if (status == NULL)
+    {
+        lv_obj_set_hidden(status_label, true);
+        return;
+    }
+    lv_label_set_text(status_label, status);
+    lv_obj_set_hidden(status_label, false);
 }
 
 static float get_temp(const float *pixel, uint16_t x, uint16_t y)
@@ -201,31 +237,26 @@ static float get_temp(const float *pixel, uint16_t x, uint16_t y)
     return pixel[x + y * THERMAL_COLS];
 }
 
-static uint8_t temp_to_intensity(float temp)
+static uint8_t temp_to_intensity(float temp, float min_temp, float max_temp)
 {
-    if (temp < thermal_min_temp)
+    if (temp < min_temp)
     {
-        temp = thermal_min_temp;
+        temp = min_temp;
     }
-    if (temp > thermal_max_temp)
+    if (temp > max_temp)
     {
-        temp = thermal_max_temp;
+        temp = max_temp;
     }
-    return 255 * (temp - thermal_min_temp) / (thermal_max_temp - thermal_min_temp);
-}
-
-static lv_color_t temp_to_color(float temp)
-{
-    return colorMap[temp_to_intensity(temp)];
+    return 255 * (temp - min_temp) / (max_temp - min_temp);
 }
 
-static uint32_t temp_to_rgb(float temp)
+static uint32_t temp_to_rgb(const ThermalImgFrame *frame, float temp)
 {
-    lv_color_t color = temp_to_color(temp);
+    lv_color_t color = colorMap[temp_to_intensity(temp, frame->scale_min_temp, frame->scale_max_temp)];
     return lv_color_to32(color) & 0xffffff;
 }
 
-void thermal_img_update(const float pixels[THERMAL_ROWS * THERMAL_COLS], Settings *settings)
+void thermal_img_colorize(const float pixels[THERMAL_ROWS * THERMAL_COLS], Settings *settings)
 {
     float center_temp = get_temp(pixels, THERMAL_COLS / 2, THERMAL_ROWS / 2);
     float min_temp = center_temp;
@@ -273,31 +304,55 @@ void thermal_img_update(const float pixels[THERMAL_ROWS * THERMAL_COLS], Setting
         settings->max_temp = new_max_temp;
     }
 
-    // Apply latest range settings
-    if (settings->min_temp != thermal_min_temp)
-    {
-        thermal_min_temp = settings->min_temp;
-        lv_label_set_text_fmt(legend_min_label, "%.0f", thermal_min_temp);
-    }
-    if (settings->max_temp != thermal_max_temp)
-    {
-        thermal_max_temp = settings->max_temp;
-        lv_label_set_text_fmt(legend_max_label, "%.0f", thermal_max_temp);
-    }
-
-    // Convert temperature to color and update image
+    // Convert temperature to color, with the latest range settings. The
+    // legend follows when the frame is presented.
+    float scale_min_temp = settings->min_temp;
+    float scale_max_temp = settings->max_temp;
     for (uint16_t y = 0; y < THERMAL_ROWS; y++)
     {
         for (uint16_t x = 0; x < THERMAL_COLS; x++)
         {
             float pixel = get_temp(pixels, x, y);
-            thermal_pixels[y * THERMAL_COLS + x] = temp_to_intensity(pixel);
+            back_frame->pixels[y * THERMAL_COLS + x] = temp_to_intensity(pixel, scale_min_temp, scale_max_temp);
         }
     }
+    back_frame->min_temp = min_temp;
+    back_frame->max_temp = max_temp;
+    back_frame->center_temp = center_temp;
+    back_frame->scale_min_temp = scale_min_temp;
+    back_frame->scale_max_temp = scale_max_temp;
+    back_ready = true;
+}
+
+bool thermal_img_present()
+{
+    if (!back_ready)
+    {
+        return false;
+    }
+
+    ThermalImgFrame *frame = back_frame;
+    back_frame = front_frame;
+    front_frame = frame;
+    back_ready = false;
     lv_obj_invalidate(thermal_img_obj);
 
-    lv_label_set_text_fmt(measurement_min_label, "#%06x " LV_SYMBOL_DOWN "# %.1f ", temp_to_rgb(min_temp), min_temp);
-    lv_label_set_text_fmt(measurement_center_label, "#%06x " CUSTOM_SYMBOL_EXPAND "# %.1f ", temp_to_rgb(center_temp),
-                          center_temp);
-    lv_label_set_text_fmt(measurement_max_label, "#%06x " LV_SYMBOL_UP "# %#.1f ", temp_to_rgb(max_temp), max_temp);
+    if (frame->scale_min_temp != thermal_min_temp)
+    {
+        thermal_min_temp = frame->scale_min_temp;
+        lv_label_set_text_fmt(legend_min_label, "%.0f", thermal_min_temp);
+    }
+    if (frame->scale_max_temp != thermal_max_temp)
+    {
+        thermal_max_temp = frame->scale_max_temp;
+        lv_label_set_text_fmt(legend_max_label, "%.0f", thermal_max_temp);
+    }
+
+    lv_label_set_text_fmt(measurement_min_label, "#%06x " LV_SYMBOL_DOWN "# %.1f ",
+                          temp_to_rgb(frame, frame->min_temp), frame->min_temp);
+    lv_label_set_text_fmt(measurement_center_label, "#%06x " CUSTOM_SYMBOL_EXPAND "# %.1f ",
+                          temp_to_rgb(frame, frame->center_temp), frame->center_temp);
+    lv_label_set_text_fmt(measurement_max_label, "#%06x " LV_SYMBOL_UP "# %#.1f ",
+                          temp_to_rgb(frame, frame->max_temp), frame->max_temp);
+    return true;
 }
@@ -9,7 +9,32 @@ extern "C" {
 #include "settings.h"
 
 void thermal_img_init();
-void thermal_img_update(const float pixels[THERMAL_ROWS * THERMAL_COLS], Settings *settings);
+
+/**
+ * Convert temperatures to colors, into a back buffer that isn't shown until
+ * thermal_img_present() is called. Replaces a frame that wasn't presented yet.
+ * Also updates the color scale's range in the settings when auto-ranging; the
+ * legend shows it once the frame is presented.
+ *
+ * @param pixels Temperature of each pixel.
+ * @param settings Color scale settings.
+ */
+void thermal_img_colorize(const float pixels[THERMAL_ROWS * THERMAL_COLS], Settings *settings);
+
+/**
+ * Show the frame colorized last, and the color scale range it was colorized
+ * with.
+ *
+ * @returns true when a new frame was shown, false if there was none.
+ */
+bool thermal_img_present();
+
+/**
+ * Show a message on top of the image (e.g. while the camera isn't ready).
+ *
+ * @param status Message to show, or NULL to hide it
+ */
+void thermal_img_set_status(const char *status);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,252 @@
+/**
+ * Bad pixel correction (MLX90641_BuildBadPixelTable() and
+ * MLX90641_ApplyBadPixelTable()) on synthetic bad pixel maps.
+ *
+ * Run using `pio test -e native`.
+ */
+
+#include <MLX90641_API.h>
+#include <unity.h>
+
+#include <stdbool.h>
+
+#define COLS 16
+#define ROWS 12
+#define PIXEL_COUNT (COLS * ROWS)
+#define END 0xFFFF
+
+#define DIAGONAL_WEIGHT 0.70710678f
+
+// Temperature of the good pixels, and the value bad pixels start with
+#define GOOD_TEMP 25.0f
+#define BAD_TEMP 1000.0f
+
+static badPixelTableMLX90641 table;
+static float to[PIXEL_COUNT];
+
+static int pixel_at(int x, int y)
+{
+    return y * COLS + x;
+}
+
+/**
+ * Temperature of a pixel in a scene with a gradient in both directions.
+ */
+static float plane(int pixel)
+{
+    return GOOD_TEMP + 0.5f * (pixel % COLS) + 0.25f * (pixel / COLS);
+}
+
+/**
+ * Fill `to` with plane(), and the bad pixels with BAD_TEMP.
+ */
+static void fill_plane(const uint16_t *pixels)
+{
+    for (int i = 0; i < PIXEL_COUNT; i++)
+    {
+        to[i] = plane(i);
+    }
+    for (int i = 0; pixels[i] != END; i++)
+    {
+        to[pixels[i]] = BAD_TEMP;
+    }
+}
+
+/**
+ * Relative weight of a neighbour, before normalizing.
+ */
+static float neighbour_weight(int pixel, int neighbour)
+{
+    bool diagonal = neighbour % COLS != pixel % COLS && neighbour / COLS != pixel / COLS;
+    return diagonal ? DIAGONAL_WEIGHT : 1.0f;
+}
+
+/**
+ * Check the table entry of a bad pixel: its neighbours and their weights.
+ * @param expected Expected good neighbours of the pixel, in row-major order.
+ */
+static void check_entry(int entry, int pixel, const int *expected, int expectedCount)
+{
+    float totalWeight = 0;
+
+    TEST_ASSERT_EQUAL(pixel, table.pixel[entry]);
+    TEST_ASSERT_EQUAL(expectedCount, table.neighbourCount[entry]);
+    for (int n = 0; n < expectedCount; n++)
+    {
+        totalWeight += neighbour_weight(pixel, expected[n]);
+    }
+    for (int n = 0; n < expectedCount; n++)
+    {
+        TEST_ASSERT_EQUAL(expected[n], table.neighbour[entry][n]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, neighbour_weight(pixel, expected[n]) / totalWeight, table.weight[entry][n]);
+    }
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_no_bad_pixels(void)
+{
+    const uint16_t pixels[] = {END};
+
+    TEST_ASSERT_EQUAL(0, MLX90641_BuildBadPixelTable(pixels, &table));
+    TEST_ASSERT_EQUAL(0, table.count);
+}
+
+void test_interior(void)
+{
+    const int x = 5;
+    const int y = 6;
+    const uint16_t pixels[] = {pixel_at(x, y), END};
+    const int neighbours[] = {pixel_at(x - 1, y - 1), pixel_at(x, y - 1), pixel_at(x + 1, y - 1),
+                              pixel_at(x - 1, y),     pixel_at(x + 1, y), pixel_at(x - 1, y + 1),
+                              pixel_at(x, y + 1),     pixel_at(x + 1, y + 1)};
+
+    TEST_ASSERT_EQUAL(0, MLX90641_BuildBadPixelTable(pixels, &table));
+    TEST_ASSERT_EQUAL(1, table.count);
+    check_entry(0, pixels[0], neighbours, 8);
+
+    // Symmetric neighbours, so exactly on the plane
+    fill_plane(pixels);
+    MLX90641_ApplyBadPixelTable(&table, to);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, plane(pixels[0]), to[pixels[0]]);
+}
+
+void test_corners(void)
+{
+    const uint16_t pixels[] = {pixel_at(0, 0), pixel_at(COLS - 1, 0), pixel_at(0, ROWS - 1),
+                               pixel_at(COLS - 1, ROWS - 1), END};
+    const int topLeft[] = {pixel_at(1, 0), pixel_at(0, 1), pixel_at(1, 1)};
+    const int topRight[] = {pixel_at(COLS - 2, 0), pixel_at(COLS - 2, 1), pixel_at(COLS - 1, 1)};
+    const int bottomLeft[] = {pixel_at(0, ROWS - 2), pixel_at(1, ROWS - 2), pixel_at(1, ROWS - 1)};
+    const int bottomRight[] = {pixel_at(COLS - 2, ROWS - 2), pixel_at(COLS - 1, ROWS - 2),
+                               pixel_at(COLS - 2, ROWS - 1)};
+
+    TEST_ASSERT_EQUAL(0, MLX90641_BuildBadPixelTable(pixels, &table));
+    TEST_ASSERT_EQUAL(4, table.count);
+    check_entry(0, pixels[0], topLeft, 3);
+    check_entry(1, pixels[1], topRight, 3);
+    check_entry(2, pixels[2], bottomLeft, 3);
+    check_entry(3, pixels[3], bottomRight, 3);
+
+    fill_plane(pixels);
+    MLX90641_ApplyBadPixelTable(&table, to);
+    for (int i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.5f, plane(pixels[i]), to[pixels[i]]);
+    }
+}
+
+void test_edges(void)
+{
+    const uint16_t pixels[] = {pixel_at(7, 0), pixel_at(0, 5), pixel_at(COLS - 1, 6), pixel_at(8, ROWS - 1), END};
+    const int top[] = {pixel_at(6, 0), pixel_at(8, 0), pixel_at(6, 1), pixel_at(7, 1), pixel_at(8, 1)};
+    const int left[] = {pixel_at(0, 4), pixel_at(1, 4), pixel_at(1, 5), pixel_at(0, 6), pixel_at(1, 6)};
+    const int right[] = {pixel_at(COLS - 2, 5), pixel_at(COLS - 1, 5), pixel_at(COLS - 2, 6),
+                         pixel_at(COLS - 2, 7), pixel_at(COLS - 1, 7)};
+    const int bottom[] = {pixel_at(7, ROWS - 2), pixel_at(8, ROWS - 2), pixel_at(9, ROWS - 2),
+                          pixel_at(7, ROWS - 1), pixel_at(9, ROWS - 1)};
+
+    TEST_ASSERT_EQUAL(0, MLX90641_BuildBadPixelTable(pixels, &table));
+    TEST_ASSERT_EQUAL(4, table.count);
+    check_entry(0, pixels[0], top, 5);
+    check_entry(1, pixels[1], left, 5);
+    check_entry(2, pixels[2], right, 5);
+    check_entry(3, pixels[3], bottom, 5);
+}
+
+void test_adjacent(void)
+{
+    // A horizontal pair: neither is used to correct the other
+    const uint16_t pixels[] = {pixel_at(4, 3), pixel_at(5, 3), END};
+    const int left[] = {pixel_at(3, 2), pixel_at(4, 2), pixel_at(5, 2), pixel_at(3, 3),
+                        pixel_at(3, 4), pixel_at(4, 4), pixel_at(5, 4)};
+    const int right[] = {pixel_at(4, 2), pixel_at(5, 2), pixel_at(6, 2), pixel_at(6, 3),
+                         pixel_at(4, 4), pixel_at(5, 4), pixel_at(6, 4)};
+
+    TEST_ASSERT_EQUAL(0, MLX90641_BuildBadPixelTable(pixels, &table));
+    TEST_ASSERT_EQUAL(2, table.count);
+    check_entry(0, pixels[0], left, 7);
+    check_entry(1, pixels[1], right, 7);
+
+    // Close to the plane, i.e. not affected by the other bad pixel
+    fill_plane(pixels);
+    MLX90641_ApplyBadPixelTable(&table, to);
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, plane(pixels[0]), to[pixels[0]]);
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, plane(pixels[1]), to[pixels[1]]);
+}
+
+void test_no_good_neighbours(void)
+{
+    // The corner pixel's neighbours are all bad
+    const uint16_t pixels[] = {pixel_at(1, 0), pixel_at(0, 1), pixel_at(1, 1), pixel_at(0, 0), END};
+
+    TEST_ASSERT_EQUAL(-3, MLX90641_BuildBadPixelTable(pixels, &table));
+    TEST_ASSERT_EQUAL(4, table.count);
+    TEST_ASSERT_EQUAL(0, table.neighbourCount[3]);
+
+    // Left as is, the others are corrected from one side only
+    fill_plane(pixels);
+    MLX90641_ApplyBadPixelTable(&table, to);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, BAD_TEMP, to[pixel_at(0, 0)]);
+    for (int i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(1.0f, plane(pixels[i]), to[pixels[i]]);
+    }
+}
+
+void test_overflow(void)
+{
+    uint16_t pixels[MLX90641_BAD_PIXELS_MAX + 2];
+
+    // Every other pixel of the first row, and one of the third row too many
+    for (int i = 0; i <= MLX90641_BAD_PIXELS_MAX; i++)
+    {
+        pixels[i] = pixel_at(2 * i % COLS, 2 * i / COLS * 2);
+    }
+    pixels[MLX90641_BAD_PIXELS_MAX + 1] = END;
+
+    TEST_ASSERT_EQUAL(-3, MLX90641_BuildBadPixelTable(pixels, &table));
+    TEST_ASSERT_EQUAL(MLX90641_BAD_PIXELS_MAX, table.count);
+    for (int i = 0; i < MLX90641_BAD_PIXELS_MAX; i++)
+    {
+        TEST_ASSERT_EQUAL(pixels[i], table.pixel[i]);
+        TEST_ASSERT_TRUE(table.neighbourCount[i] > 0);
+    }
+
+    // The pixels in the table are corrected, the extra one isn't
+    fill_plane(pixels);
+    MLX90641_ApplyBadPixelTable(&table, to);
+    for (int i = 0; i < MLX90641_BAD_PIXELS_MAX; i++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.5f, plane(pixels[i]), to[pixels[i]]);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, BAD_TEMP, to[pixels[MLX90641_BAD_PIXELS_MAX]]);
+}
+
+void test_invalid_pixel(void)
+{
+    const uint16_t pixels[] = {PIXEL_COUNT, END};
+
+    TEST_ASSERT_EQUAL(-3, MLX90641_BuildBadPixelTable(pixels, &table));
+    TEST_ASSERT_EQUAL(0, table.count);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_no_bad_pixels);
+    RUN_TEST(test_interior);
+    RUN_TEST(test_corners);
+    RUN_TEST(test_edges);
+    RUN_TEST(test_adjacent);
+    RUN_TEST(test_no_good_neighbours);
+    RUN_TEST(test_overflow);
+    RUN_TEST(test_invalid_pixel);
+    return UNITY_END();
+}
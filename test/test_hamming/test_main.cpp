@@ -0,0 +1,252 @@
+/**
+ * EEPROM Hamming decoding (HammingDecode(), used by MLX90641_DumpEE()),
+ * against the original bit-by-bit decoder of the Melexis driver: on every
+ * 16-bit word, and on every 11-bit value with 0, 1 and 2 bit errors.
+ *
+ * Run using `pio test -e native`.
+ */
+
+#include <MLX90641_API.h>
+#include <mlx90641_synthetic.h>
+#include <unity.h>
+
+#include <string.h>
+
+#define EEPROM_WORDS 832
+#define FIRST_WORD 16 // Words before this one have no Hamming code
+
+// Internal to the driver
+int HammingDecode(uint16_t *eeData);
+
+/**
+ * HammingDecode() of the original Melexis driver.
+ */
+static int original_hamming_decode(uint16_t *eeData)
+{
+    int error = 0;
+    int16_t parity[5];
+    int8_t D[16];
+    int16_t check;
+    uint16_t data;
+    uint16_t mask;
+
+    for (int addr = 16; addr < 832; addr++)
+    {
+        parity[0] = -1;
+        parity[1] = -1;
+        parity[2] = -1;
+        parity[3] = -1;
+        parity[4] = -1;
+
+        data = eeData[addr];
+
+        mask = 1;
+        for (int i = 0; i < 16; i++)
+        {
+            D[i] = (data & mask) >> i;
+            mask = mask << 1;
+        }
+
+        parity[0] = D[0] ^ D[1] ^ D[3] ^ D[4] ^ D[6] ^ D[8] ^ D[10] ^ D[11];
+        parity[1] = D[0] ^ D[2] ^ D[3] ^ D[5] ^ D[6] ^ D[9] ^ D[10] ^ D[12];
+        parity[2] = D[1] ^ D[2] ^ D[3] ^ D[7] ^ D[8] ^ D[9] ^ D[10] ^ D[13];
+        parity[3] = D[4] ^ D[5] ^ D[6] ^ D[7] ^ D[8] ^ D[9] ^ D[10] ^ D[14];
+        parity[4] = D[0] ^ D[1] ^ D[2] ^ D[3] ^ D[4] ^ D[5] ^ D[6] ^ D[7] ^ D[8] ^ D[9] ^ D[10] ^ D[11] ^ D[12] ^
+                    D[13] ^ D[14] ^ D[15];
+
+        if ((parity[0] != 0) || (parity[1] != 0) || (parity[2] != 0) || (parity[3] != 0) || (parity[4] != 0))
+        {
+            check = (parity[0] << 0) + (parity[1] << 1) + (parity[2] << 2) + (parity[3] << 3) + (parity[4] << 4);
+
+            if ((check > 15) && (check < 32))
+            {
+                switch (check)
+                {
+                case 16:
+                    D[15] = 1 - D[15];
+                    break;
+
+                case 24:
+                    D[14] = 1 - D[14];
+                    break;
+
+                case 20:
+                    D[13] = 1 - D[13];
+                    break;
+
+                case 18:
+                    D[12] = 1 - D[12];
+                    break;
+
+                case 17:
+                    D[11] = 1 - D[11];
+                    break;
+
+                case 31:
+                    D[10] = 1 - D[10];
+                    break;
+
+                case 30:
+                    D[9] = 1 - D[9];
+                    break;
+
+                case 29:
+                    D[8] = 1 - D[8];
+                    break;
+
+                case 28:
+                    D[7] = 1 - D[7];
+                    break;
+
+                case 27:
+                    D[6] = 1 - D[6];
+                    break;
+
+                case 26:
+                    D[5] = 1 - D[5];
+                    break;
+
+                case 25:
+                    D[4] = 1 - D[4];
+                    break;
+
+                case 23:
+                    D[3] = 1 - D[3];
+                    break;
+
+                case 22:
+                    D[2] = 1 - D[2];
+                    break;
+
+                case 21:
+                    D[1] = 1 - D[1];
+                    break;
+
+                case 19:
+                    D[0] = 1 - D[0];
+                    break;
+                }
+
+                if (error == 0)
+                {
+                    error = -9;
+                }
+
+                data = 0;
+                mask = 1;
+                for (int i = 0; i < 16; i++)
+                {
+                    data = data + D[i] * mask;
+                    mask = mask << 1;
+                }
+            }
+            else
+            {
+                error = -10;
+            }
+        }
+
+        eeData[addr] = data & 0x07FF;
+    }
+
+    return error;
+}
+
+static uint16_t eeData[EEPROM_WORDS];
+static uint16_t originalEeData[EEPROM_WORDS];
+
+/**
+ * Decode eeData using both decoders, and compare the results.
+ * @returns the error code.
+ */
+static int decode_both()
+{
+    memcpy(originalEeData, eeData, sizeof(eeData));
+    int error = HammingDecode(eeData);
+    int originalError = original_hamming_decode(originalEeData);
+
+    TEST_ASSERT_EQUAL_INT(originalError, error);
+    TEST_ASSERT_EQUAL_MEMORY(originalEeData, eeData, sizeof(eeData));
+    return error;
+}
+
+void setUp(void)
+{
+    memset(eeData, 0, sizeof(eeData));
+}
+
+void tearDown(void)
+{
+}
+
+void test_every_word(void)
+{
+    // A whole EEPROM (816 words) at a time
+    for (uint32_t first = 0; first < 0x10000; first += EEPROM_WORDS - FIRST_WORD)
+    {
+        for (int addr = FIRST_WORD; addr < EEPROM_WORDS; addr++)
+        {
+            eeData[addr] = (uint16_t)(first + addr - FIRST_WORD);
+        }
+        decode_both();
+    }
+}
+
+void test_error_patterns(void)
+{
+    eepromStatsMLX90641 stats;
+
+    for (uint16_t value = 0; value < 0x0800; value++)
+    {
+        uint16_t word = mlx90641_synthetic_hamming_encode(value);
+
+        // No error
+        eeData[FIRST_WORD] = word;
+        TEST_ASSERT_EQUAL_INT(0, decode_both());
+        TEST_ASSERT_EQUAL_HEX16(value, eeData[FIRST_WORD]);
+
+        for (int bit1 = 0; bit1 < 16; bit1++)
+        {
+            // Single bit errors are corrected
+            eeData[FIRST_WORD] = word ^ (1 << bit1);
+            TEST_ASSERT_EQUAL_INT(-9, decode_both());
+            TEST_ASSERT_EQUAL_HEX16(value, eeData[FIRST_WORD]);
+            MLX90641_GetEEPROMStats(&stats);
+            TEST_ASSERT_EQUAL(1, stats.corrected);
+            TEST_ASSERT_EQUAL(0, stats.uncorrectable);
+
+            // Double bit errors are detected
+            for (int bit2 = bit1 + 1; bit2 < 16; bit2++)
+            {
+                eeData[FIRST_WORD] = word ^ (1 << bit1) ^ (1 << bit2);
+                TEST_ASSERT_EQUAL_INT(-10, decode_both());
+                MLX90641_GetEEPROMStats(&stats);
+                TEST_ASSERT_EQUAL(0, stats.corrected);
+                TEST_ASSERT_EQUAL(1, stats.uncorrectable);
+            }
+        }
+    }
+}
+
+void test_error_priority(void)
+{
+    eepromStatsMLX90641 stats;
+
+    // An uncorrectable word anywhere makes the whole EEPROM uncorrectable
+    eeData[FIRST_WORD] = mlx90641_synthetic_hamming_encode(0x123) ^ 0x0003;
+    eeData[FIRST_WORD + 1] = mlx90641_synthetic_hamming_encode(0x456) ^ 0x0100;
+    eeData[EEPROM_WORDS - 1] = mlx90641_synthetic_hamming_encode(0x789) ^ 0x8000;
+    TEST_ASSERT_EQUAL_INT(-10, decode_both());
+    MLX90641_GetEEPROMStats(&stats);
+    TEST_ASSERT_EQUAL(2, stats.corrected);
+    TEST_ASSERT_EQUAL(1, stats.uncorrectable);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_every_word);
+    RUN_TEST(test_error_patterns);
+    RUN_TEST(test_error_priority);
+    return UNITY_END();
+}
@@ -0,0 +1,409 @@
+/**
+ * Accuracy and speed of the radiometry calculations, against a
+ * double-precision reference: the driver's original calculation, before it
+ * was optimized. Uses the frames of a recording, and synthetic frames covering
+ * a wider temperature range.
+ *
+ * There is no recording of a real sensor in the repository yet: the default
+ * one (recordings/demo.mlxrec) is synthetic, i.e. it uses the synthetic
+ * calibration data too. Set the THERMAL_RECORDING environment variable to the
+ * path of a recording made on the device to check a real sensor's calibration.
+ *
+ * Run using `pio test -e native` from the project directory.
+ */
+
+#include <MLX90641_API.h>
+#include <mlx90641_recording.h>
+#include <mlx90641_synthetic.h>
+#include <unity.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define RECORDING_PATH "recordings/demo.mlxrec"
+#define MAX_FRAMES 100
+#define SYNTHETIC_FRAMES 64
+#define FRAME_WORDS 242
+#define PIXEL_COUNT 192
+#define TA_SHIFT 5
+
+// Number of times each kernel calculates all frames, for timing
+#define TIMING_REPEAT 200
+
+// Maximum error (degC) against the reference
+#define MAX_ERROR_FLOAT 0.001
+#define MAX_ERROR_FIXED 0.01
+#define MAX_ERROR_FOURTH_ROOT 0.01
+
+// Domain of FastFourthRoot(), in degC, and number of values tested
+#define FOURTH_ROOT_MIN -40
+#define FOURTH_ROOT_MAX 600
+#define FOURTH_ROOT_VALUES 64000
+
+// Internal to the driver
+float FastFourthRoot(float value);
+
+static paramsMLX90641 recordingParams;
+static uint16_t recordingFrames[MAX_FRAMES][FRAME_WORDS];
+static uint32_t recordingCount = 0;
+
+static paramsMLX90641 syntheticParams;
+static uint16_t syntheticFrames[SYNTHETIC_FRAMES][FRAME_WORDS];
+
+typedef void (*Kernel)(uint16_t *frameData, const paramsMLX90641 *params, const frameContextMLX90641 *context,
+                       float emissivity, float tr, float *result);
+
+/**
+ * Load (up to MAX_FRAMES frames of) the recording into recordingFrames, and
+ * extract its calibration parameters into recordingParams.
+ */
+static void load_recording()
+{
+    static Mlx90641RecordingHeader header;
+    static Mlx90641RecordingFrame frame;
+    uint16_t ee[MLX90641_RECORDING_EEPROM_WORDS];
+    const char *path = getenv("THERMAL_RECORDING");
+    if (path == NULL)
+    {
+        path = RECORDING_PATH;
+    }
+    FILE *file = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL_MESSAGE(file, "Cannot open recording, run from the project directory");
+    printf("Recording: %s\n", path);
+
+    TEST_ASSERT_EQUAL(1, fread(&header, sizeof(header), 1, file));
+    TEST_ASSERT_EQUAL(MLX90641_RECORDING_MAGIC, header.magic);
+    TEST_ASSERT_EQUAL(MLX90641_RECORDING_VERSION, header.version);
+
+    while (recordingCount < MAX_FRAMES && fread(&frame, sizeof(frame), 1, file) == 1)
+    {
+        memcpy(recordingFrames[recordingCount++], frame.data, sizeof(frame.data));
+    }
+    fclose(file);
+    TEST_ASSERT_TRUE(recordingCount > 2);
+
+    // Remove the Hamming code, like MLX90641_DumpEE()
+    for (int i = 0; i < MLX90641_RECORDING_EEPROM_WORDS; i++)
+    {
+        ee[i] = i < 16 ? header.eeprom[i] : header.eeprom[i] & 0x07FF;
+    }
+    TEST_ASSERT_EQUAL(0, MLX90641_ExtractParameters(ee, &recordingParams));
+}
+
+/**
+ * Build syntheticFrames from the synthetic EEPROM: a gradient from -20 to
+ * 120 degC with a hot spot of up to 300 degC (about the most the synthetic
+ * sensor's ADC can represent), at varying Ta and Vdd.
+ */
+static void make_synthetic_frames()
+{
+    uint16_t ee[MLX90641_SYNTHETIC_EEPROM_WORDS];
+    float temps[PIXEL_COUNT];
+
+    mlx90641_synthetic_eeprom(ee);
+    TEST_ASSERT_EQUAL(0, MLX90641_ExtractParameters(ee, &syntheticParams));
+
+    for (int frame = 0; frame < SYNTHETIC_FRAMES; frame++)
+    {
+        for (int i = 0; i < PIXEL_COUNT; i++)
+        {
+            temps[i] = -20 + i * 140.0f / PIXEL_COUNT;
+        }
+        temps[(frame * 37) % PIXEL_COUNT] = 100 + frame * 200.0f / SYNTHETIC_FRAMES;
+        mlx90641_synthetic_frame(&syntheticParams, temps, 20 + (frame % 8) * 3.0f, 3.25f + (frame % 5) * 0.025f,
+                                 frame % 2, syntheticFrames[frame]);
+    }
+}
+
+static double signed_word(uint16_t value)
+{
+    return value > 32767 ? value - 65536.0 : value;
+}
+
+static double reference_vdd(const paramsMLX90641 *params, const uint16_t *frameData)
+{
+    int resolutionRAM = (frameData[240] & 0x0C00) >> 10;
+    double resolutionCorrection = pow(2, params->resolutionEE) / pow(2, resolutionRAM);
+
+    return (resolutionCorrection * signed_word(frameData[234]) - params->vdd25) / params->kVdd + 3.3;
+}
+
+static double reference_ta(const paramsMLX90641 *params, const uint16_t *frameData)
+{
+    double vdd = reference_vdd(params, frameData);
+    double ptat = signed_word(frameData[224]);
+    double ptatArt = signed_word(frameData[192]);
+
+    ptatArt = (ptat / (ptat * params->alphaPTAT + ptatArt)) * pow(2, 18);
+    return (ptatArt / (1 + params->KvPTAT * (vdd - 3.3)) - params->vPTAT25) / params->KtPTAT + 25;
+}
+
+/**
+ * MLX90641_CalculateTo() of the original Melexis driver, in double precision.
+ */
+static void reference_to(const paramsMLX90641 *params, const uint16_t *frameData, double emissivity, double tr,
+                         double *result)
+{
+    int subPage = frameData[241];
+    double vdd = reference_vdd(params, frameData);
+    double ta = reference_ta(params, frameData);
+    double ta4 = pow(ta + 273.15, 4);
+    double tr4 = pow(tr + 273.15, 4);
+    double taTr = tr4 - (tr4 - ta4) / emissivity;
+    double alphaCorrR[8];
+    double gain;
+    double irDataCP;
+
+    alphaCorrR[1] = 1 / (1 + params->ksTo[1] * 20);
+    alphaCorrR[0] = alphaCorrR[1] / (1 + params->ksTo[0] * 20);
+    alphaCorrR[2] = 1;
+    alphaCorrR[3] = (1 + params->ksTo[2] * params->ct[3]);
+    for (int i = 4; i < 8; i++)
+    {
+        alphaCorrR[i] = alphaCorrR[i - 1] * (1 + params->ksTo[i - 1] * (params->ct[i] - params->ct[i - 1]));
+    }
+
+    gain = params->gainEE / signed_word(frameData[202]);
+    irDataCP = signed_word(frameData[200]) * gain;
+    irDataCP -= params->cpOffset * (1 + params->cpKta * (ta - 25)) * (1 + params->cpKv * (vdd - 3.3));
+
+    for (int pixel = 0; pixel < PIXEL_COUNT; pixel++)
+    {
+        double kta = params->kta[pixel] / pow(2, params->ktaScale);
+        double kv = params->kv[pixel] / pow(2, params->kvScale);
+        double irData = signed_word(frameData[pixel]) * gain;
+        irData -= params->offset[subPage][pixel] * (1 + kta * (ta - 25)) * (1 + kv * (vdd - 3.3));
+        irData -= params->tgc * irDataCP;
+        irData /= emissivity;
+
+        double alphaCompensated = SCALEALPHA * pow(2, params->alphaScale) / params->alpha[pixel];
+        alphaCompensated *= 1 + params->KsTa * (ta - 25);
+
+        double Sx = alphaCompensated * alphaCompensated * alphaCompensated * (irData + alphaCompensated * taTr);
+        Sx = sqrt(sqrt(Sx)) * params->ksTo[2];
+        double To = sqrt(sqrt(irData / (alphaCompensated * (1 - params->ksTo[2] * 273.15) + Sx) + taTr)) - 273.15;
+
+        int range = 0;
+        while (range < 7 && To >= params->ct[range + 1])
+        {
+            range++;
+        }
+
+        To = sqrt(sqrt(irData / (alphaCompensated * alphaCorrR[range] *
+                                 (1 + params->ksTo[range] * (To - params->ct[range]))) +
+                       taTr)) -
+             273.15;
+        result[pixel] = To;
+    }
+}
+
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * Compare a kernel to the reference on the given frames, at several
+ * emissivities, and time it. Prints the maximum and RMS error and time per
+ * frame.
+ * @returns the maximum error.
+ */
+static double measure_kernel(const char *name, Kernel kernel, const paramsMLX90641 *params,
+                             uint16_t frames[][FRAME_WORDS], uint32_t count)
+{
+    static const float emissivities[] = {1.0f, 0.95f, 0.8f};
+    static frameContextMLX90641 contexts[MAX_FRAMES];
+    float result[PIXEL_COUNT];
+    double expected[PIXEL_COUNT];
+    double maxError = 0;
+    double sumSquares = 0;
+    double start;
+    double elapsed;
+    char message[120];
+
+    for (uint32_t frame = 0; frame < count; frame++)
+    {
+        MLX90641_GetFrameContext(frames[frame], params, &contexts[frame]);
+    }
+
+    for (int e = 0; e < 3; e++)
+    {
+        for (uint32_t frame = 0; frame < count; frame++)
+        {
+            float tr = contexts[frame].ta - TA_SHIFT;
+            kernel(frames[frame], params, &contexts[frame], emissivities[e], tr, result);
+            reference_to(params, frames[frame], emissivities[e], tr, expected);
+
+            for (int pixel = 0; pixel < PIXEL_COUNT; pixel++)
+            {
+                double error = fabs(result[pixel] - expected[pixel]);
+                if (isnan(error) || error > maxError)
+                {
+                    maxError = error; // NaN sticks, failing the test
+                }
+                sumSquares += error * error;
+            }
+        }
+    }
+
+    start = now_ns();
+    for (int repeat = 0; repeat < TIMING_REPEAT; repeat++)
+    {
+        for (uint32_t frame = 0; frame < count; frame++)
+        {
+            kernel(frames[frame], params, &contexts[frame], 0.95f, contexts[frame].ta - TA_SHIFT, result);
+        }
+    }
+    elapsed = now_ns() - start;
+
+    snprintf(message, sizeof(message), "%s: max error %.5f degC, RMS %.5f degC, %.0f ns/frame", name, maxError,
+             sqrt(sumSquares / (3 * count * PIXEL_COUNT)), elapsed / (TIMING_REPEAT * count));
+    TEST_MESSAGE(message);
+    return maxError;
+}
+
+void setUp(void)
+{
+    if (recordingCount == 0)
+    {
+        load_recording();
+        make_synthetic_frames();
+    }
+}
+
+void tearDown(void)
+{
+}
+
+void test_vdd_and_ta(void)
+{
+    for (uint32_t frame = 0; frame < recordingCount; frame++)
+    {
+        uint16_t *frameData = recordingFrames[frame];
+        frameContextMLX90641 context;
+        MLX90641_GetFrameContext(frameData, &recordingParams, &context);
+
+        TEST_ASSERT_FLOAT_WITHIN(1e-4, reference_vdd(&recordingParams, frameData),
+                                 MLX90641_GetVdd(frameData, &recordingParams));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, reference_ta(&recordingParams, frameData),
+                                 MLX90641_GetTa(frameData, &recordingParams));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, reference_ta(&recordingParams, frameData), context.ta);
+    }
+}
+
+void test_float_recording(void)
+{
+    double maxError = measure_kernel("CalculateTo, recording", MLX90641_CalculateTo, &recordingParams,
+                                     recordingFrames, recordingCount);
+    TEST_ASSERT_TRUE(maxError < MAX_ERROR_FLOAT);
+}
+
+void test_float_synthetic(void)
+{
+    double maxError = measure_kernel("CalculateTo, synthetic", MLX90641_CalculateTo, &syntheticParams,
+                                     syntheticFrames, SYNTHETIC_FRAMES);
+    TEST_ASSERT_TRUE(maxError < MAX_ERROR_FLOAT);
+}
+
+void test_fixed_recording(void)
+{
+    double maxError = measure_kernel("CalculateToFixed, recording", MLX90641_CalculateToFixed, &recordingParams,
+                                     recordingFrames, recordingCount);
+    TEST_ASSERT_TRUE(maxError < MAX_ERROR_FIXED);
+}
+
+void test_fixed_synthetic(void)
+{
+    double maxError = measure_kernel("CalculateToFixed, synthetic", MLX90641_CalculateToFixed, &syntheticParams,
+                                     syntheticFrames, SYNTHETIC_FRAMES);
+    TEST_ASSERT_TRUE(maxError < MAX_ERROR_FIXED);
+}
+
+/**
+ * A corrupted frame with a zero gain word gives NAN, instead of dividing by zero.
+ */
+void test_fixed_zero_gain(void)
+{
+    uint16_t frameData[FRAME_WORDS];
+    frameContextMLX90641 context;
+    float result[PIXEL_COUNT];
+
+    memcpy(frameData, syntheticFrames[0], sizeof(frameData));
+    frameData[202] = 0;
+    MLX90641_GetFrameContext(frameData, &syntheticParams, &context);
+    MLX90641_CalculateToFixed(frameData, &syntheticParams, &context, 1, context.ta - TA_SHIFT, result);
+    for (int i = 0; i < PIXEL_COUNT; i++)
+    {
+        TEST_ASSERT_TRUE(isnan(result[i]));
+    }
+}
+
+/**
+ * Maximum error of FastFourthRoot() (used with MLX90641_FAST_FOURTH_ROOT=1)
+ * in degC, and its speed compared to sqrtf(sqrtf()).
+ */
+void test_fast_fourth_root(void)
+{
+    static float values[FOURTH_ROOT_VALUES];
+    static float roots[FOURTH_ROOT_VALUES];
+    double maxError = 0;
+    double maxErrorSqrt = 0;
+    double start;
+    double fastTime;
+    double sqrtTime;
+    char message[160];
+
+    for (int i = 0; i < FOURTH_ROOT_VALUES; i++)
+    {
+        double kelvin = 273.15 + FOURTH_ROOT_MIN + (FOURTH_ROOT_MAX - FOURTH_ROOT_MIN) * (double)i / FOURTH_ROOT_VALUES;
+        values[i] = (float)pow(kelvin, 4);
+        maxError = fmax(maxError, fabs(FastFourthRoot(values[i]) - kelvin));
+        maxErrorSqrt = fmax(maxErrorSqrt, fabs(sqrtf(sqrtf(values[i])) - kelvin));
+    }
+
+    start = now_ns();
+    for (int repeat = 0; repeat < TIMING_REPEAT; repeat++)
+    {
+        for (int i = 0; i < FOURTH_ROOT_VALUES; i++)
+        {
+            roots[i] = FastFourthRoot(values[i]);
+        }
+    }
+    fastTime = now_ns() - start;
+
+    start = now_ns();
+    for (int repeat = 0; repeat < TIMING_REPEAT; repeat++)
+    {
+        for (int i = 0; i < FOURTH_ROOT_VALUES; i++)
+        {
+            roots[i] = sqrtf(sqrtf(values[i]));
+        }
+    }
+    sqrtTime = now_ns() - start;
+    TEST_ASSERT_TRUE(roots[0] > 0); // Keep the loops
+
+    snprintf(message, sizeof(message),
+             "FastFourthRoot: max error %.5f degC (sqrtf: %.5f degC), %.2f ns/call (sqrtf: %.2f ns/call, %.2fx)",
+             maxError, maxErrorSqrt, fastTime / (TIMING_REPEAT * FOURTH_ROOT_VALUES),
+             sqrtTime / (TIMING_REPEAT * FOURTH_ROOT_VALUES), sqrtTime / fastTime);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(maxError < MAX_ERROR_FOURTH_ROOT);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_vdd_and_ta);
+    RUN_TEST(test_float_recording);
+    RUN_TEST(test_float_synthetic);
+    RUN_TEST(test_fixed_recording);
+    RUN_TEST(test_fixed_synthetic);
+    RUN_TEST(test_fixed_zero_gain);
+    RUN_TEST(test_fast_fourth_root);
+    return UNITY_END();
+}
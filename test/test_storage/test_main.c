@@ -0,0 +1,135 @@
+/**
+ * Storage of settings and the sensor's calibration cache (src/storage.c),
+ * on the simulator's RAM-backed flash (hal/sdl2/hal_flash.c).
+ *
+ * Run using `pio test -e native`.
+ */
+
+#include "hal_flash.h"
+#include "storage.h"
+
+#include <MLX90641_API.h>
+#include <mlx90641_synthetic.h>
+#include <unity.h>
+
+#include <string.h>
+
+#define CALIBRATION_MAGIC (0xca11b0a7)
+#define CALIBRATION_KEY (0x12345678)
+
+#define SLOT_ADDRESS(slot) ((slot)*0x00010000)
+
+static paramsMLX90641 params;
+static paramsMLX90641 loaded;
+
+void setUp(void)
+{
+    static bool initialized = false;
+    uint16_t ee[MLX90641_SYNTHETIC_EEPROM_WORDS];
+
+    // Flash starts erased, and keeps its contents between tests
+    if (!initialized)
+    {
+        TEST_ASSERT_TRUE(hal_flash_init());
+        mlx90641_synthetic_eeprom(ee);
+        TEST_ASSERT_EQUAL(0, MLX90641_ExtractParameters(ee, &params));
+        initialized = true;
+    }
+    memset(&loaded, 0, sizeof(loaded));
+}
+
+void tearDown(void)
+{
+}
+
+void test_erased(void)
+{
+    TEST_ASSERT_FALSE(storage_read(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &loaded,
+                                   sizeof(loaded)));
+}
+
+void test_calibration_round_trip(void)
+{
+    // Spans multiple flash sectors
+    TEST_ASSERT_TRUE(sizeof(params) > 4096);
+
+    TEST_ASSERT_TRUE(
+        storage_write(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &params, sizeof(params)));
+    TEST_ASSERT_TRUE(
+        storage_read(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &loaded, sizeof(loaded)));
+    TEST_ASSERT_EQUAL_MEMORY(&params, &loaded, sizeof(params));
+}
+
+void test_calibration_key_mismatch(void)
+{
+    TEST_ASSERT_TRUE(
+        storage_write(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &params, sizeof(params)));
+
+    // Other sensor or calibration format
+    TEST_ASSERT_FALSE(
+        storage_read(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY + 1, &loaded, sizeof(loaded)));
+    // Other size of paramsMLX90641
+    TEST_ASSERT_FALSE(
+        storage_read(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &loaded, sizeof(loaded) - 4));
+    // Other kind of data
+    TEST_ASSERT_FALSE(storage_read(STORAGE_SLOT_SETTINGS, CALIBRATION_MAGIC, CALIBRATION_KEY, &loaded,
+                                   sizeof(loaded)));
+}
+
+void test_corrupted_data(void)
+{
+    static uint8_t sector[4096];
+    size_t address = SLOT_ADDRESS(STORAGE_SLOT_CALIBRATION) + 4096;
+
+    TEST_ASSERT_TRUE(
+        storage_write(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &params, sizeof(params)));
+
+    // Flip a bit in the second sector
+    TEST_ASSERT_TRUE(hal_flash_read(address, sector, sizeof(sector)));
+    sector[100] ^= 0x10;
+    TEST_ASSERT_TRUE(hal_flash_write(address, sector, sizeof(sector)));
+
+    TEST_ASSERT_FALSE(
+        storage_read(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &loaded, sizeof(loaded)));
+}
+
+void test_slots_independent(void)
+{
+    uint32_t settings = 0xdeadbeef;
+    uint32_t loaded_settings = 0;
+
+    TEST_ASSERT_TRUE(
+        storage_write(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &params, sizeof(params)));
+    TEST_ASSERT_TRUE(storage_write(STORAGE_SLOT_SETTINGS, 1, 2, &settings, sizeof(settings)));
+
+    TEST_ASSERT_TRUE(storage_read(STORAGE_SLOT_SETTINGS, 1, 2, &loaded_settings, sizeof(loaded_settings)));
+    TEST_ASSERT_EQUAL_UINT32(settings, loaded_settings);
+    TEST_ASSERT_TRUE(
+        storage_read(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, &loaded, sizeof(loaded)));
+    TEST_ASSERT_EQUAL_MEMORY(&params, &loaded, sizeof(params));
+}
+
+void test_too_large(void)
+{
+    static uint8_t data[0x00010000];
+
+    // No room for the header
+    TEST_ASSERT_FALSE(storage_write(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, data,
+                                    sizeof(data)));
+    TEST_ASSERT_TRUE(storage_write(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, data,
+                                   sizeof(data) - 64));
+    TEST_ASSERT_TRUE(storage_read(STORAGE_SLOT_CALIBRATION, CALIBRATION_MAGIC, CALIBRATION_KEY, data,
+                                  sizeof(data) - 64));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_erased); // First, while the flash is still erased
+    RUN_TEST(test_calibration_round_trip);
+    RUN_TEST(test_calibration_key_mismatch);
+    RUN_TEST(test_corrupted_data);
+    RUN_TEST(test_slots_independent);
+    RUN_TEST(test_too_large);
+    return UNITY_END();
+}